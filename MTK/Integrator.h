@@ -3,6 +3,8 @@
 
 #include "Trait.h"
 #include "Polynomial.h"
+#include "QuasiRandom.h"
+#include "Random.h"
 
 static_assert(__cplusplus >= 201700, "C++17 or higher is required.");
 
@@ -12,6 +14,8 @@ namespace mtk
     class NewtonCotesIntegrator;
     template <typename Real>
     class GaussianIntegrator;
+    template <typename Real>
+    class MonteCarloIntegrator;
 
     template <typename Real>
     class NewtonCotesIntegrator
@@ -69,6 +73,65 @@ namespace mtk
 
         GaussianIntegrator &operator=(const GaussianIntegrator &integrator);
     };
+
+    template <typename Real>
+    class MonteCarloIntegrator
+    {
+    private:
+        static constexpr size_t _parallel = 16;
+
+    private:
+        Vector<Real> _min;
+        Vector<Real> _max;
+        size_t _batch;
+        size_t _max_sample;
+        Real _tolerance;
+        size_t _seed;
+        bool _antithetic;
+        bool _stratified;
+        bool _quasi;
+        Real _error;
+        size_t _sample;
+
+    public:
+        const Vector<Real> &min;
+        const Vector<Real> &max;
+        const size_t &batch;
+        const size_t &max_sample;
+        const Real &tolerance;
+        const bool &antithetic;
+        const bool &stratified;
+        const bool &quasi;
+        const Real &error;
+        const size_t &sample;
+
+    private:
+        void point(BasicRandom<Philox4x32> &random, const Matrix<Real> &sobol, Matrix<Real> &u) const;
+        const Real estimate(const std::function<void(BasicRandom<Philox4x32> &, Vector<Real> &, Vector<Real> &)> &batch,
+                            const bool &control, const Real &integral);
+
+    public:
+        MonteCarloIntegrator(const Vector<Real> &min, const Vector<Real> &max);
+        MonteCarloIntegrator(const MonteCarloIntegrator &integrator);
+
+        void setRange(const Vector<Real> &min, const Vector<Real> &max);
+        void setBatch(const size_t &batch);
+        void setMaxSample(const size_t &max_sample);
+        void setTolerance(const Real &tolerance);
+        void setSeed(const size_t &seed);
+        void setAntithetic(const bool &antithetic);
+        void setStratified(const bool &stratified);
+        void setQuasi(const bool &quasi);
+
+        const Real operator()(const std::function<const Real(const Vector<Real> &)> &f);
+        const Real control(const std::function<const Real(const Vector<Real> &)> &f,
+                           const std::function<const Real(const Vector<Real> &)> &g, const Real &integral);
+        const Real importance(const std::function<const Real(const Vector<Real> &)> &f,
+                              const std::function<const Real(const Vector<Real> &)> &density,
+                              const std::function<const Vector<Real>(BasicRandom<Philox4x32> &)> &sampler);
+
+        MonteCarloIntegrator &operator=(const MonteCarloIntegrator &integrator);
+    };
 };
 
 #include "Integrator.hpp"
@@ -1,6 +1,9 @@
 #ifndef MTK_INTEGRAL_HPP
 #define MTK_INTEGRAL_HPP
 
+#include <array>
+#include <cmath>
+
 #include "Integrator.h"
 #include "Polynomial.hpp"
 
@@ -190,6 +193,264 @@ namespace mtk
         }
         return (*this);
     }
+
+    template <typename Real>
+    inline void MonteCarloIntegrator<Real>::point(BasicRandom<Philox4x32> &random, const Matrix<Real> &sobol, Matrix<Real> &u) const
+    {
+        const size_t d = u.rows();
+        const size_t n = u.cols();
+        if (_quasi)
+        {
+            Vector<Real> shift(d);
+            random.uniform(shift, Real(0.0), Real(1.0));
+            for (size_t i = 0; i < n; i++)
+            {
+                for (size_t j = 0; j < d; j++)
+                {
+                    u(j, i) = sobol(j, i) + shift(j);
+                    u(j, i) -= (u(j, i) >= 1.0) ? 1.0 : 0.0;
+                }
+            }
+            return;
+        }
+        random.uniform(u, Real(0.0), Real(1.0));
+        if (_stratified)
+        {
+            std::vector<size_t> stratum(n);
+            for (size_t j = 0; j < d; j++)
+            {
+                for (size_t i = 0; i < n; i++)
+                {
+                    stratum[i] = i;
+                }
+                for (size_t i = n - 1; i > 0; i--)
+                {
+                    std::swap(stratum[i], stratum[random.uniform(size_t(0), i)]);
+                }
+                for (size_t i = 0; i < n; i++)
+                {
+                    u(j, i) = (stratum[i] + u(j, i)) / n;
+                }
+            }
+        }
+    }
+
+    template <typename Real>
+    inline const Real MonteCarloIntegrator<Real>::estimate(const std::function<void(BasicRandom<Philox4x32> &, Vector<Real> &, Vector<Real> &)> &batch,
+                                                           const bool &control, const Real &integral)
+    {
+        const Philox4x32 engine(_seed);
+        std::vector<Real> mean_f, mean_g;
+        Real sum_f = 0.0, sum_g = 0.0, sum_fg = 0.0, sum_gg = 0.0;
+        Real res = 0.0;
+        _error = std::numeric_limits<Real>::infinity();
+        _sample = 0;
+        while (_sample < _max_sample)
+        {
+            const size_t begin = mean_f.size();
+            mean_f.resize(begin + _parallel);
+            mean_g.resize(begin + _parallel);
+            std::vector<std::array<Real, 4>> sum(_parallel);
+#pragma omp parallel for
+            for (size_t b = 0; b < _parallel; b++)
+            {
+                BasicRandom<Philox4x32> random(engine.stream(begin + b));
+                Vector<Real> f(_batch), g = Vector<Real>::Zero(_batch);
+                batch(random, f, g);
+                mean_f[begin + b] = f.mean();
+                mean_g[begin + b] = g.mean();
+                sum[b] = {f.sum(), g.sum(), f.dot(g), g.squaredNorm()};
+            }
+            for (size_t b = 0; b < _parallel; b++)
+            {
+                sum_f += sum[b][0];
+                sum_g += sum[b][1];
+                sum_fg += sum[b][2];
+                sum_gg += sum[b][3];
+            }
+            _sample += _parallel * _batch;
+            const size_t m = mean_f.size();
+            Real beta = 0.0;
+            if (control)
+            {
+                const Real var = sum_gg - sum_g * sum_g / _sample;
+                beta = (var > 0.0) ? (sum_fg - sum_f * sum_g / _sample) / var : 0.0;
+            }
+            Real s = 0.0, s2 = 0.0;
+            for (size_t b = 0; b < m; b++)
+            {
+                const Real r = mean_f[b] - beta * (mean_g[b] - integral);
+                s += r;
+                s2 += r * r;
+            }
+            res = s / m;
+            _error = std::sqrt(std::max(s2 - s * res, Real(0.0)) / (m * (m - 1)));
+            if (_error <= _tolerance)
+            {
+                break;
+            }
+        }
+        return res;
+    }
+
+    template <typename Real>
+    inline MonteCarloIntegrator<Real>::MonteCarloIntegrator(const Vector<Real> &min, const Vector<Real> &max)
+        : min(_min), max(_max), batch(_batch), max_sample(_max_sample), tolerance(_tolerance), antithetic(_antithetic),
+          stratified(_stratified), quasi(_quasi), error(_error), sample(_sample)
+    {
+        setRange(min, max);
+        this->_batch = 4096;
+        this->_max_sample = 1 << 24;
+        this->_tolerance = Trait<float>::epsilon();
+        this->_seed = 0;
+        this->_antithetic = false;
+        this->_stratified = false;
+        this->_quasi = false;
+        this->_error = std::numeric_limits<Real>::infinity();
+        this->_sample = 0;
+    }
+
+    template <typename Real>
+    inline MonteCarloIntegrator<Real>::MonteCarloIntegrator(const MonteCarloIntegrator<Real> &integrator)
+        : min(_min), max(_max), batch(_batch), max_sample(_max_sample), tolerance(_tolerance), antithetic(_antithetic),
+          stratified(_stratified), quasi(_quasi), error(_error), sample(_sample)
+    {
+        (*this) = integrator;
+    }
+
+    template <typename Real>
+    inline void MonteCarloIntegrator<Real>::setRange(const Vector<Real> &min, const Vector<Real> &max)
+    {
+        if (min.size() != max.size() || min.size() == 0)
+        {
+            printf("Error at: file %s line %d.\n", __FILE__, __LINE__);
+            exit(0);
+        }
+        this->_min = min;
+        this->_max = max;
+        return;
+    }
+
+    template <typename Real>
+    inline void MonteCarloIntegrator<Real>::setBatch(const size_t &batch)
+    {
+        this->_batch = std::max(batch, size_t(2));
+        return;
+    }
+
+    template <typename Real>
+    inline void MonteCarloIntegrator<Real>::setMaxSample(const size_t &max_sample)
+    {
+        this->_max_sample = max_sample;
+        return;
+    }
+
+    template <typename Real>
+    inline void MonteCarloIntegrator<Real>::setTolerance(const Real &tolerance)
+    {
+        this->_tolerance = std::abs(tolerance);
+        return;
+    }
+
+    template <typename Real>
+    inline void MonteCarloIntegrator<Real>::setSeed(const size_t &seed)
+    {
+        this->_seed = seed;
+        return;
+    }
+
+    template <typename Real>
+    inline void MonteCarloIntegrator<Real>::setAntithetic(const bool &antithetic)
+    {
+        this->_antithetic = antithetic;
+        return;
+    }
+
+    template <typename Real>
+    inline void MonteCarloIntegrator<Real>::setStratified(const bool &stratified)
+    {
+        this->_stratified = stratified;
+        return;
+    }
+
+    template <typename Real>
+    inline void MonteCarloIntegrator<Real>::setQuasi(const bool &quasi)
+    {
+        this->_quasi = quasi;
+        return;
+    }
+
+    template <typename Real>
+    inline const Real MonteCarloIntegrator<Real>::operator()(const std::function<const Real(const Vector<Real> &)> &f)
+    {
+        return control(f, nullptr, 0.0);
+    }
+
+    template <typename Real>
+    inline const Real MonteCarloIntegrator<Real>::control(const std::function<const Real(const Vector<Real> &)> &f,
+                                                          const std::function<const Real(const Vector<Real> &)> &g, const Real &integral)
+    {
+        const Vector<Real> k = _max - _min;
+        const Real volume = k.prod();
+        const Matrix<Real> sobol = _quasi ? Sobol(_min.size()).next<Real>(_batch) : Matrix<Real>();
+        return estimate(
+            [&](BasicRandom<Philox4x32> &random, Vector<Real> &fx, Vector<Real> &gx)
+            {
+                Matrix<Real> u(_min.size(), _batch);
+                point(random, sobol, u);
+                for (size_t i = 0; i < _batch; i++)
+                {
+                    const Vector<Real> x = _min + k.cwiseProduct(u.col(i));
+                    fx(i) = volume * f(x);
+                    gx(i) = g ? volume * g(x) : 0.0;
+                    if (_antithetic)
+                    {
+                        const Vector<Real> y = _max - k.cwiseProduct(u.col(i));
+                        fx(i) = (fx(i) + volume * f(y)) / 2.0;
+                        gx(i) = g ? (gx(i) + volume * g(y)) / 2.0 : 0.0;
+                    }
+                }
+            },
+            bool(g), integral);
+    }
+
+    template <typename Real>
+    inline const Real MonteCarloIntegrator<Real>::importance(const std::function<const Real(const Vector<Real> &)> &f,
+                                                             const std::function<const Real(const Vector<Real> &)> &density,
+                                                             const std::function<const Vector<Real>(BasicRandom<Philox4x32> &)> &sampler)
+    {
+        return estimate(
+            [&](BasicRandom<Philox4x32> &random, Vector<Real> &fx, Vector<Real> &)
+            {
+                for (size_t i = 0; i < _batch; i++)
+                {
+                    const Vector<Real> x = sampler(random);
+                    const Real p = density(x);
+                    fx(i) = (p > 0.0) ? f(x) / p : 0.0;
+                }
+            },
+            false, 0.0);
+    }
+
+    template <typename Real>
+    inline MonteCarloIntegrator<Real> &MonteCarloIntegrator<Real>::operator=(const MonteCarloIntegrator<Real> &integrator)
+    {
+        if (this != &integrator)
+        {
+            this->_min = integrator.min;
+            this->_max = integrator.max;
+            this->_batch = integrator.batch;
+            this->_max_sample = integrator.max_sample;
+            this->_tolerance = integrator.tolerance;
+            this->_seed = integrator._seed;
+            this->_antithetic = integrator.antithetic;
+            this->_stratified = integrator.stratified;
+            this->_quasi = integrator.quasi;
+            this->_error = integrator.error;
+            this->_sample = integrator.sample;
+        }
+        return (*this);
+    }
 };
 
 #endif
@@ -2,6 +2,9 @@
 #define MTK_NUMBER_H
 
 #include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
 #include <vector>
 
 static_assert(__cplusplus >= 201700, "C++17 or higher is required.");
@@ -9,6 +12,7 @@ static_assert(__cplusplus >= 201700, "C++17 or higher is required.");
 namespace mtk
 {
     class Prime;
+    class PrimeRange;
 
     template <typename Type>
     constexpr Type pow(const Type &x, const size_t &n);
@@ -21,6 +25,10 @@ namespace mtk
 
     class Prime
     {
+    private:
+        static constexpr const char *_magic = "MTKPRIME";
+        static constexpr uint32_t _version = 1;
+
     private:
         size_t _max;
         std::vector<size_t> _num;
@@ -29,16 +37,78 @@ namespace mtk
         const size_t &max;
         const std::vector<size_t> &num;
 
+    private:
+        void decode(const unsigned char *data, const size_t &size);
+
     public:
         Prime(const size_t &m);
+        Prime(const std::string &file);
         Prime(const Prime &p);
 
+        void save(const std::string &file) const;
+
         const size_t index(const size_t &x) const;
         const bool operator()(const size_t &n);
         const std::vector<size_t> factorization(const size_t &x);
 
         Prime &operator=(const Prime &p);
     };
+
+    class PrimeRange
+    {
+    public:
+        class Iterator
+        {
+        private:
+            const PrimeRange *_range;
+            size_t _low;
+            size_t _value;
+            std::vector<bool> _flag;
+
+        private:
+            void sieve(const size_t &low);
+            void next(const size_t &x);
+
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = size_t;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const size_t *;
+            using reference = const size_t &;
+
+        public:
+            Iterator(const PrimeRange *range, const size_t &x);
+            Iterator(const Iterator &it);
+
+            const size_t &operator*() const;
+            Iterator &operator++();
+            Iterator operator++(int);
+
+            const bool operator==(const Iterator &it) const;
+            const bool operator!=(const Iterator &it) const;
+
+            Iterator &operator=(const Iterator &it);
+        };
+
+    private:
+        size_t _min;
+        size_t _max;
+        size_t _segment;
+        std::vector<size_t> _base;
+
+    public:
+        const size_t &min;
+        const size_t &max;
+
+    public:
+        PrimeRange(const size_t &min, const size_t &max);
+        PrimeRange(const PrimeRange &range);
+
+        const Iterator begin() const;
+        const Iterator end() const;
+
+        PrimeRange &operator=(const PrimeRange &range);
+    };
 };
 
 #include "Number.hpp"
@@ -1,6 +1,9 @@
 #ifndef MTK_NUMBER_HPP
 #define MTK_NUMBER_HPP
 
+#include <cstring>
+#include <fstream>
+#include <iterator>
 #include <set>
 
 #include "Number.h"
@@ -74,7 +77,7 @@ namespace mtk
 
     inline const bool isPrime(const size_t &x)
     {
-        static Random random;
+        BasicRandom<Philox4x32> random(x);
         if (x == 2)
         {
             return true;
@@ -144,8 +147,119 @@ namespace mtk
         }
     }
 
+    inline Prime::Prime(const std::string &file) : max(_max), num(_num)
+    {
+        std::ifstream stream(file, std::ios::binary);
+        if (!stream)
+        {
+            printf("Error at: file %s line %d.\n", __FILE__, __LINE__);
+            exit(0);
+        }
+        std::vector<char> buffer((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+        decode((const unsigned char *)buffer.data(), buffer.size());
+    }
+
     inline Prime::Prime(const Prime &p) : max(_max), num(_num), _max(p.max), _num(p.num) {}
 
+    inline void Prime::decode(const unsigned char *data, const size_t &size)
+    {
+        size_t pos = 0;
+        auto read = [&data, &size, &pos](const size_t &n) -> uint64_t
+        {
+            if (pos + n > size)
+            {
+                printf("Error at: file %s line %d.\n", __FILE__, __LINE__);
+                exit(0);
+            }
+            uint64_t res = 0;
+            for (size_t i = 0; i < n; i++)
+            {
+                res |= ((uint64_t)data[pos + i] << (8 * i));
+            }
+            pos += n;
+            return res;
+        };
+        const size_t length = std::strlen(_magic);
+        if (size < length || std::memcmp(data, _magic, length) != 0)
+        {
+            printf("Error at: file %s line %d.\n", __FILE__, __LINE__);
+            exit(0);
+        }
+        pos = length;
+        if (read(4) != _version)
+        {
+            printf("Error at: file %s line %d.\n", __FILE__, __LINE__);
+            exit(0);
+        }
+        read(4);
+        this->_max = read(8);
+        const size_t count = read(8);
+        if (count > size - pos)
+        {
+            printf("Error at: file %s line %d.\n", __FILE__, __LINE__);
+            exit(0);
+        }
+        _num.clear();
+        _num.reserve(count);
+        size_t x = 1;
+        for (size_t i = 0; i < count; i++)
+        {
+            uint64_t gap = read(1);
+            gap = (gap != 0) ? (2 * gap) : read(8);
+            if (gap == 0 || x > _max || gap > _max - x)
+            {
+                printf("Error at: file %s line %d.\n", __FILE__, __LINE__);
+                exit(0);
+            }
+            x += gap;
+            _num.push_back(x);
+        }
+        if (pos != size)
+        {
+            printf("Error at: file %s line %d.\n", __FILE__, __LINE__);
+            exit(0);
+        }
+    }
+
+    inline void Prime::save(const std::string &file) const
+    {
+        std::vector<unsigned char> buffer;
+        buffer.reserve(32 + _num.size());
+        auto write = [&buffer](const uint64_t &x, const size_t &n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                buffer.push_back((unsigned char)(x >> (8 * i)));
+            }
+        };
+        buffer.insert(buffer.end(), _magic, _magic + std::strlen(_magic));
+        write(_version, 4);
+        write(0, 4);
+        write(_max, 8);
+        write(_num.size(), 8);
+        size_t x = 1;
+        for (size_t i = 0; i < _num.size(); i++)
+        {
+            const size_t gap = _num[i] - x;
+            if (gap % 2 == 0 && gap / 2 >= 1 && gap / 2 <= UCHAR_MAX)
+            {
+                write(gap / 2, 1);
+            }
+            else
+            {
+                write(0, 1);
+                write(gap, 8);
+            }
+            x = _num[i];
+        }
+        std::ofstream stream(file, std::ios::binary);
+        if (!stream.write((const char *)buffer.data(), buffer.size()))
+        {
+            printf("Error at: file %s line %d.\n", __FILE__, __LINE__);
+            exit(0);
+        }
+    }
+
     inline const size_t Prime::index(const size_t &x) const
     {
         size_t l = 0, r = _num.size() - 1;
@@ -223,6 +337,167 @@ namespace mtk
         }
         return (*this);
     }
+
+    inline PrimeRange::Iterator::Iterator(const PrimeRange *range, const size_t &x) : _range(range), _low(0), _value(0)
+    {
+        if (x <= _range->max)
+        {
+            next(x);
+        }
+    }
+
+    inline PrimeRange::Iterator::Iterator(const Iterator &it)
+        : _range(it._range), _low(it._low), _value(it._value), _flag(it._flag) {}
+
+    inline void PrimeRange::Iterator::sieve(const size_t &low)
+    {
+        const size_t high = low + 2 * _range->_segment;
+        _low = low;
+        _flag.assign(_range->_segment, true);
+        if (low == 0)
+        {
+            _flag[0] = false;
+        }
+        for (size_t i = 1; i < _range->_base.size(); i++)
+        {
+            const size_t p = _range->_base[i];
+            if (p * p >= high)
+            {
+                break;
+            }
+            size_t j = std::max<size_t>(p * p, ((low + p - 1) / p) * p);
+            if (j % 2 == 0)
+            {
+                j += p;
+            }
+            for (; j < high; j += 2 * p)
+            {
+                _flag[(j - low - 1) / 2] = false;
+            }
+        }
+    }
+
+    inline void PrimeRange::Iterator::next(const size_t &x)
+    {
+        if (x <= 2 && _range->max >= 2)
+        {
+            _value = 2;
+            return;
+        }
+        size_t n = (x % 2 == 0) ? (x + 1) : x;
+        while (n <= _range->max)
+        {
+            if (_flag.empty() || n < _low || n >= _low + 2 * _range->_segment)
+            {
+                sieve(n - 1);
+            }
+            for (size_t i = (n - _low - 1) / 2; i < _flag.size() && n <= _range->max; i++, n += 2)
+            {
+                if (_flag[i])
+                {
+                    _value = n;
+                    return;
+                }
+            }
+        }
+        _value = 0;
+    }
+
+    inline const size_t &PrimeRange::Iterator::operator*() const
+    {
+        return _value;
+    }
+
+    inline PrimeRange::Iterator &PrimeRange::Iterator::operator++()
+    {
+        if (_value != 0)
+        {
+            next(_value + 1);
+        }
+        return (*this);
+    }
+
+    inline PrimeRange::Iterator PrimeRange::Iterator::operator++(int)
+    {
+        Iterator it(*this);
+        this->operator++();
+        return it;
+    }
+
+    inline const bool PrimeRange::Iterator::operator==(const Iterator &it) const
+    {
+        return _value == it._value;
+    }
+
+    inline const bool PrimeRange::Iterator::operator!=(const Iterator &it) const
+    {
+        return _value != it._value;
+    }
+
+    inline PrimeRange::Iterator &PrimeRange::Iterator::operator=(const Iterator &it)
+    {
+        if (this != &it)
+        {
+            this->_range = it._range;
+            this->_low = it._low;
+            this->_value = it._value;
+            this->_flag = it._flag;
+        }
+        return (*this);
+    }
+
+    inline PrimeRange::PrimeRange(const size_t &min, const size_t &max) : min(_min), max(_max)
+    {
+        this->_min = min;
+        this->_max = max;
+        size_t r = (size_t)std::sqrt((long double)max);
+        while (r * r > max)
+        {
+            r--;
+        }
+        while ((r + 1) * (r + 1) <= max)
+        {
+            r++;
+        }
+        this->_segment = std::max<size_t>(r, SHRT_MAX);
+        std::vector<bool> flag(r + 1, true);
+        for (size_t i = 2; i <= r; i++)
+        {
+            if (flag[i])
+            {
+                _base.push_back(i);
+                for (size_t j = i * i; j <= r; j += i)
+                {
+                    flag[j] = false;
+                }
+            }
+        }
+    }
+
+    inline PrimeRange::PrimeRange(const PrimeRange &range)
+        : _min(range.min), _max(range.max), _segment(range._segment), _base(range._base), min(_min), max(_max) {}
+
+    inline const PrimeRange::Iterator PrimeRange::begin() const
+    {
+        return Iterator(this, _min);
+    }
+
+    inline const PrimeRange::Iterator PrimeRange::end() const
+    {
+        return Iterator(this, _max + 1);
+    }
+
+    inline PrimeRange &PrimeRange::operator=(const PrimeRange &range)
+    {
+        if (this != &range)
+        {
+            this->_min = range.min;
+            this->_max = range.max;
+            this->_segment = range._segment;
+            this->_base = range._base;
+        }
+        return (*this);
+    }
 };
 
 #endif
\ No newline at end of file
@@ -1,6 +1,11 @@
 #ifndef MTK_POLYNOMIAL_H
 #define MTK_POLYNOMIAL_H
 
+#include <array>
+#include <complex>
+#include <deque>
+#include <utility>
+
 #include "Trait.h"
 
 static_assert(__cplusplus >= 201700, "C++17 or higher is required.");
@@ -14,6 +19,16 @@ namespace mtk
     template <typename Real>
     class Trait<Polynomial<Real>>;
     template <typename Real>
+    class SparsePolynomial;
+    template <typename Real>
+    class Trait<SparsePolynomial<Real>>;
+    template <typename Real, size_t N>
+    class StaticPolynomial;
+    template <typename Real>
+    class BarycentricInterpolator;
+    template <typename Real>
+    class NewtonInterpolator;
+    template <typename Real>
     class OrthonormalPolynomial;
 
     template <typename Real>
@@ -56,6 +71,72 @@ namespace mtk
     template <typename Real>
     std::ostream &operator<<(std::ostream &stream, const Polynomial<Real> &p);
 
+    template <typename Real>
+    const SparsePolynomial<Real> operator-(const SparsePolynomial<Real> &p);
+    template <typename Real>
+    const SparsePolynomial<Real> operator+(const SparsePolynomial<Real> &p);
+    template <typename Real1, typename Real2>
+    const SparsePolynomial<std::common_type_t<Real1, Real2>> operator+(const SparsePolynomial<Real1> &p1, const SparsePolynomial<Real2> &p2);
+    template <typename Real, typename Type>
+    const SparsePolynomial<Real> operator+(const SparsePolynomial<Real> &p, const Type &k);
+    template <typename Real, typename Type>
+    const SparsePolynomial<Real> operator+(const Type &k, const SparsePolynomial<Real> &p);
+    template <typename Real1, typename Real2>
+    const SparsePolynomial<std::common_type_t<Real1, Real2>> operator-(const SparsePolynomial<Real1> &p1, const SparsePolynomial<Real2> &p2);
+    template <typename Real, typename Type>
+    const SparsePolynomial<Real> operator-(const SparsePolynomial<Real> &p, const Type &k);
+    template <typename Real, typename Type>
+    const SparsePolynomial<Real> operator-(const Type &k, const SparsePolynomial<Real> &p);
+    template <typename Real1, typename Real2>
+    const SparsePolynomial<std::common_type_t<Real1, Real2>> operator*(const SparsePolynomial<Real1> &p1, const SparsePolynomial<Real2> &p2);
+    template <typename Real, typename Type>
+    const SparsePolynomial<Real> operator*(const Type &k, const SparsePolynomial<Real> &p);
+    template <typename Real, typename Type>
+    const SparsePolynomial<Real> operator*(const SparsePolynomial<Real> &p, const Type &k);
+    template <typename Real, typename Type>
+    const SparsePolynomial<Real> operator/(const SparsePolynomial<Real> &p, const Type &k);
+
+    template <typename Real>
+    const bool operator==(const SparsePolynomial<Real> &p1, const SparsePolynomial<Real> &p2);
+    template <typename Real>
+    const bool operator!=(const SparsePolynomial<Real> &p1, const SparsePolynomial<Real> &p2);
+
+    template <typename Real>
+    std::ostream &operator<<(std::ostream &stream, const SparsePolynomial<Real> &p);
+
+    template <typename Real, size_t N>
+    constexpr const StaticPolynomial<Real, N> operator-(const StaticPolynomial<Real, N> &p);
+    template <typename Real, size_t N>
+    constexpr const StaticPolynomial<Real, N> operator+(const StaticPolynomial<Real, N> &p);
+    template <typename Real, size_t N, size_t M>
+    constexpr const StaticPolynomial<Real, std::max(N, M)> operator+(const StaticPolynomial<Real, N> &p1, const StaticPolynomial<Real, M> &p2);
+    template <typename Real, size_t N, typename Type>
+    constexpr const StaticPolynomial<Real, N> operator+(const StaticPolynomial<Real, N> &p, const Type &k);
+    template <typename Real, size_t N, typename Type>
+    constexpr const StaticPolynomial<Real, N> operator+(const Type &k, const StaticPolynomial<Real, N> &p);
+    template <typename Real, size_t N, size_t M>
+    constexpr const StaticPolynomial<Real, std::max(N, M)> operator-(const StaticPolynomial<Real, N> &p1, const StaticPolynomial<Real, M> &p2);
+    template <typename Real, size_t N, typename Type>
+    constexpr const StaticPolynomial<Real, N> operator-(const StaticPolynomial<Real, N> &p, const Type &k);
+    template <typename Real, size_t N, typename Type>
+    constexpr const StaticPolynomial<Real, N> operator-(const Type &k, const StaticPolynomial<Real, N> &p);
+    template <typename Real, size_t N, size_t M>
+    constexpr const StaticPolynomial<Real, N + M> operator*(const StaticPolynomial<Real, N> &p1, const StaticPolynomial<Real, M> &p2);
+    template <typename Real, size_t N, typename Type>
+    constexpr const StaticPolynomial<Real, N> operator*(const Type &k, const StaticPolynomial<Real, N> &p);
+    template <typename Real, size_t N, typename Type>
+    constexpr const StaticPolynomial<Real, N> operator*(const StaticPolynomial<Real, N> &p, const Type &k);
+    template <typename Real, size_t N, typename Type>
+    constexpr const StaticPolynomial<Real, N> operator/(const StaticPolynomial<Real, N> &p, const Type &k);
+
+    template <typename Real, size_t N, size_t M>
+    constexpr const bool operator==(const StaticPolynomial<Real, N> &p1, const StaticPolynomial<Real, M> &p2);
+    template <typename Real, size_t N, size_t M>
+    constexpr const bool operator!=(const StaticPolynomial<Real, N> &p1, const StaticPolynomial<Real, M> &p2);
+
+    template <typename Real, size_t N>
+    std::ostream &operator<<(std::ostream &stream, const StaticPolynomial<Real, N> &p);
+
     template <typename Real>
     const std::vector<Polynomial<Real>> fundamentalPolynomial(const std::vector<Real> &x);
     template <typename Real>
@@ -66,6 +147,8 @@ namespace mtk
     const Polynomial<Real> differential(const Polynomial<Real> &p);
     template <typename Real>
     const Polynomial<Real> integral(const Polynomial<Real> &p, const Real &x);
+    template <typename Real>
+    const std::pair<Polynomial<Real>, Polynomial<Real>> divmod(const Polynomial<Real> &p1, const Polynomial<Real> &p2);
 
     template <typename Real>
     class ConditionList
@@ -103,6 +186,20 @@ namespace mtk
     template <typename Real>
     class Polynomial
     {
+    public:
+        struct Root
+        {
+            std::complex<Real> value;
+            Real error;
+            size_t multiplicity;
+        };
+
+    private:
+        static constexpr size_t _karatsuba = 32;
+        static constexpr size_t _fft = 1024;
+        static constexpr size_t _block = 256;
+        static constexpr size_t _estrin = 16;
+
     private:
         std::vector<Real> _coefs;
         size_t _degree;
@@ -111,15 +208,32 @@ namespace mtk
         const std::vector<Real> &coefs;
         const size_t &degree;
 
+    private:
+        static void schoolbook(const Real *a, const size_t &n, const Real *b, const size_t &m, Real *c);
+        static void karatsuba(const Real *a, const Real *b, const size_t &n, Real *c);
+        static void fft(std::vector<std::complex<Real>> &a, const bool &inverse);
+        static void multiply(const Real *a, const size_t &n, const Real *b, const size_t &m, Real *c);
+        static const std::vector<Real> inverse(const std::vector<Real> &f, const size_t &k);
+        static void shift(std::vector<Real> &q, const Real &t);
+        static const size_t variation(const std::vector<Real> &q);
+        static void isolate(const std::vector<Real> &c, const Real &a, const Real &b, const size_t &depth, std::vector<std::pair<Real, Real>> &res);
+
     public:
         Polynomial(const size_t &n = 0);
         Polynomial(const Polynomial &p);
         Polynomial(const std::vector<Real> &coefs);
+        Polynomial(const SparsePolynomial<Real> &p);
+        template <size_t N>
+        Polynomial(const StaticPolynomial<Real, N> &p);
 
         const Polynomial differential() const;
         const Polynomial integral(const Real &x) const;
         const std::vector<Real> root(const Real &delta = Trait<float>::epsilon()) const;
+        const std::vector<Root> complexRoot(const size_t &max_iteration = std::numeric_limits<short>::max()) const;
+        const std::vector<std::pair<Real, Real>> isolate(const Real &min, const Real &max) const;
+        const std::vector<Real> root(const Real &min, const Real &max, const Real &delta = Trait<float>::epsilon()) const;
         const bool isRoot(const Real &x, const Real &delta = Trait<float>::epsilon()) const;
+        const std::pair<Polynomial, Polynomial> divmod(const Polynomial &p) const;
 
         const bool equal(const Polynomial &p, const Real &delta = Trait<Real>::epsilon()) const;
 
@@ -137,6 +251,13 @@ namespace mtk
         Polynomial &operator/=(const Polynomial &p);
         Polynomial &operator%=(const Polynomial &p);
 
+        const Real horner(const Real &x) const;
+        const Real estrin(const Real &x) const;
+        const std::vector<Real> derivatives(const Real &x, const size_t &k) const;
+        void evaluate(const Real *first, const Real *last, Real *res) const;
+        const std::vector<Real> evaluate(const std::vector<Real> &x) const;
+        const Vector<Real> evaluate(const Vector<Real> &x) const;
+
         const Real operator()(const Real &x) const;
         const Real operator[](const size_t &degree) const;
         Real &operator[](const size_t &degree);
@@ -153,6 +274,176 @@ namespace mtk
         static const Polynomial<Real> basis(const size_t &n);
     };
 
+    template <typename Real>
+    class SparsePolynomial
+    {
+    public:
+        class Coefficient
+        {
+        private:
+            SparsePolynomial *_p;
+            size_t _n;
+
+        public:
+            Coefficient(SparsePolynomial *p, const size_t &n);
+
+            operator Real() const;
+            Coefficient &operator=(const Real &k);
+        };
+
+    private:
+        std::vector<std::pair<size_t, Real>> _terms;
+        size_t _degree;
+
+    public:
+        const std::vector<std::pair<size_t, Real>> &terms;
+        const size_t &degree;
+
+    private:
+        static const Real power(const Real &x, const size_t &n);
+
+        void normalize();
+
+    public:
+        SparsePolynomial();
+        SparsePolynomial(const SparsePolynomial &p);
+        SparsePolynomial(const std::vector<std::pair<size_t, Real>> &terms);
+        SparsePolynomial(const Polynomial<Real> &p);
+
+        const SparsePolynomial differential() const;
+        const SparsePolynomial integral(const Real &x) const;
+
+        const bool equal(const SparsePolynomial &p, const Real &delta = Trait<Real>::epsilon()) const;
+
+        std::string print(const Real &precision = Trait<float>::epsilon()) const;
+
+        SparsePolynomial &operator=(const SparsePolynomial &p);
+        SparsePolynomial &operator=(const Real &k);
+        SparsePolynomial &operator+=(const SparsePolynomial &p);
+        SparsePolynomial &operator+=(const Real &k);
+        SparsePolynomial &operator-=(const SparsePolynomial &p);
+        SparsePolynomial &operator-=(const Real &k);
+        SparsePolynomial &operator*=(const SparsePolynomial &p);
+        SparsePolynomial &operator*=(const Real &k);
+        SparsePolynomial &operator/=(const Real &k);
+
+        const Real operator()(const Real &x) const;
+        const Real operator[](const size_t &degree) const;
+        Coefficient operator[](const size_t &degree);
+    };
+
+    template <typename Real>
+    class Trait<SparsePolynomial<Real>>
+    {
+    public:
+        Trait() = delete;
+
+        static const SparsePolynomial<Real> zero();
+        static const SparsePolynomial<Real> identity();
+        static const SparsePolynomial<Real> basis(const size_t &n);
+    };
+
+    template <typename Real, size_t N>
+    class StaticPolynomial
+    {
+    private:
+        std::array<Real, N + 1> _coefs;
+
+    public:
+        static constexpr size_t degree = N;
+
+    private:
+        template <size_t... I>
+        constexpr const Real horner(const Real &x, std::index_sequence<I...>) const;
+
+    public:
+        constexpr StaticPolynomial();
+        constexpr StaticPolynomial(const StaticPolynomial &p) = default;
+        constexpr StaticPolynomial(const std::array<Real, N + 1> &coefs);
+        StaticPolynomial(const Polynomial<Real> &p);
+
+        constexpr const StaticPolynomial<Real, (N > 0) ? N - 1 : 0> differential() const;
+        constexpr const StaticPolynomial<Real, N + 1> integral(const Real &x) const;
+
+        std::string print(const Real &precision = Trait<float>::epsilon()) const;
+
+        constexpr StaticPolynomial &operator=(const StaticPolynomial &p) = default;
+        template <size_t M>
+        constexpr StaticPolynomial &operator+=(const StaticPolynomial<Real, M> &p);
+        constexpr StaticPolynomial &operator+=(const Real &k);
+        template <size_t M>
+        constexpr StaticPolynomial &operator-=(const StaticPolynomial<Real, M> &p);
+        constexpr StaticPolynomial &operator-=(const Real &k);
+        constexpr StaticPolynomial &operator*=(const Real &k);
+        constexpr StaticPolynomial &operator/=(const Real &k);
+
+        constexpr const Real operator()(const Real &x) const;
+        constexpr const Real operator[](const size_t &degree) const;
+        constexpr Real &operator[](const size_t &degree);
+    };
+
+    template <typename Real>
+    class BarycentricInterpolator
+    {
+    private:
+        std::vector<Real> _node;
+        std::vector<Real> _value;
+        std::vector<Real> _weight;
+        Real _scale;
+
+    public:
+        const std::vector<Real> &node;
+        const std::vector<Real> &value;
+        const std::vector<Real> &weight;
+
+    public:
+        BarycentricInterpolator();
+        BarycentricInterpolator(const BarycentricInterpolator &b);
+        BarycentricInterpolator(const std::vector<Real> &x, const std::vector<Real> &y);
+
+        static const BarycentricInterpolator chebyshev(const std::function<const Real(const Real &)> &f, const size_t &n, const Real &min, const Real &max);
+
+        void add(const Real &x, const Real &y);
+
+        void evaluate(const Real *first, const Real *last, Real *res) const;
+        const std::vector<Real> evaluate(const std::vector<Real> &x) const;
+        const Vector<Real> evaluate(const Vector<Real> &x) const;
+
+        const Real operator()(const Real &x) const;
+
+        BarycentricInterpolator &operator=(const BarycentricInterpolator &b);
+    };
+
+    template <typename Real>
+    class NewtonInterpolator
+    {
+    private:
+        std::deque<Real> _node;
+        std::deque<Real> _coefs;
+        size_t _window;
+
+    public:
+        const std::deque<Real> &node;
+        const std::deque<Real> &coefs;
+        const size_t &window;
+
+    public:
+        NewtonInterpolator(const size_t &window = 0);
+        NewtonInterpolator(const NewtonInterpolator &n);
+        NewtonInterpolator(const std::vector<Real> &x, const std::vector<Real> &y, const size_t &window = 0);
+
+        void add(const Real &x, const Real &y);
+        const Polynomial<Real> polynomial() const;
+
+        void evaluate(const Real *first, const Real *last, Real *res) const;
+        const std::vector<Real> evaluate(const std::vector<Real> &x) const;
+        const Vector<Real> evaluate(const Vector<Real> &x) const;
+
+        const Real operator()(const Real &x) const;
+
+        NewtonInterpolator &operator=(const NewtonInterpolator &n);
+    };
+
     template <typename Real>
     class OrthogonalPolynomial
     {
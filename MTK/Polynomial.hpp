@@ -1,6 +1,10 @@
 #ifndef MTK_POLYNOMIAL_HPP
 #define MTK_POLYNOMIAL_HPP
 
+#include <algorithm>
+#include <numbers>
+#include <tuple>
+
 #include "Polynomial.h"
 
 namespace mtk
@@ -216,6 +220,262 @@ namespace mtk
         return stream;
     }
 
+    template <typename Real>
+    inline const SparsePolynomial<Real> operator-(const SparsePolynomial<Real> &p)
+    {
+        SparsePolynomial<Real> res(p);
+        res *= -1.0;
+        return res;
+    }
+
+    template <typename Real>
+    inline const SparsePolynomial<Real> operator+(const SparsePolynomial<Real> &p)
+    {
+        return p;
+    }
+
+    template <typename Real1, typename Real2>
+    inline const SparsePolynomial<std::common_type_t<Real1, Real2>> operator+(const SparsePolynomial<Real1> &p1,
+                                                                              const SparsePolynomial<Real2> &p2)
+    {
+        SparsePolynomial<std::common_type_t<Real1, Real2>> res = p1;
+        res += p2;
+        return res;
+    }
+
+    template <typename Real, typename Type>
+    inline const SparsePolynomial<Real> operator+(const SparsePolynomial<Real> &p, const Type &k)
+    {
+        SparsePolynomial<Real> res = p;
+        res += k;
+        return res;
+    }
+
+    template <typename Real, typename Type>
+    inline const SparsePolynomial<Real> operator+(const Type &k, const SparsePolynomial<Real> &p)
+    {
+        SparsePolynomial<Real> res = p;
+        res += k;
+        return res;
+    }
+
+    template <typename Real1, typename Real2>
+    inline const SparsePolynomial<std::common_type_t<Real1, Real2>> operator-(const SparsePolynomial<Real1> &p1,
+                                                                              const SparsePolynomial<Real2> &p2)
+    {
+        SparsePolynomial<std::common_type_t<Real1, Real2>> res = p1;
+        res -= p2;
+        return res;
+    }
+
+    template <typename Real, typename Type>
+    inline const SparsePolynomial<Real> operator-(const SparsePolynomial<Real> &p, const Type &k)
+    {
+        SparsePolynomial<Real> res = p;
+        res -= k;
+        return res;
+    }
+
+    template <typename Real, typename Type>
+    inline const SparsePolynomial<Real> operator-(const Type &k, const SparsePolynomial<Real> &p)
+    {
+        SparsePolynomial<Real> res = -p;
+        res += k;
+        return res;
+    }
+
+    template <typename Real1, typename Real2>
+    inline const SparsePolynomial<std::common_type_t<Real1, Real2>> operator*(const SparsePolynomial<Real1> &p1,
+                                                                              const SparsePolynomial<Real2> &p2)
+    {
+        SparsePolynomial<std::common_type_t<Real1, Real2>> res = p1;
+        res *= p2;
+        return res;
+    }
+
+    template <typename Real, typename Type>
+    inline const SparsePolynomial<Real> operator*(const Type &k, const SparsePolynomial<Real> &p)
+    {
+        SparsePolynomial<Real> res = p;
+        res *= k;
+        return res;
+    }
+
+    template <typename Real, typename Type>
+    inline const SparsePolynomial<Real> operator*(const SparsePolynomial<Real> &p, const Type &k)
+    {
+        SparsePolynomial<Real> res = p;
+        res *= k;
+        return res;
+    }
+
+    template <typename Real, typename Type>
+    inline const SparsePolynomial<Real> operator/(const SparsePolynomial<Real> &p, const Type &k)
+    {
+        SparsePolynomial<Real> res = p;
+        res /= k;
+        return res;
+    }
+
+    template <typename Real>
+    inline const bool operator==(const SparsePolynomial<Real> &p1, const SparsePolynomial<Real> &p2)
+    {
+        size_t i = 0, j = 0;
+        while (i < p1.terms.size() || j < p2.terms.size())
+        {
+            const size_t n = std::min(i < p1.terms.size() ? p1.terms[i].first : std::numeric_limits<size_t>::max(),
+                                      j < p2.terms.size() ? p2.terms[j].first : std::numeric_limits<size_t>::max());
+            const Real a = (i < p1.terms.size() && p1.terms[i].first == n) ? p1.terms[i++].second : 0.0;
+            const Real b = (j < p2.terms.size() && p2.terms[j].first == n) ? p2.terms[j++].second : 0.0;
+            if (std::abs(a - b) > std::max(std::abs(a), std::abs(b)) * Trait<float>::epsilon())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename Real>
+    inline const bool operator!=(const SparsePolynomial<Real> &p1, const SparsePolynomial<Real> &p2)
+    {
+        return !(p1 == p2);
+    }
+
+    template <typename Real>
+    inline std::ostream &operator<<(std::ostream &stream, const SparsePolynomial<Real> &p)
+    {
+        stream << p.print(Trait<float>::min());
+        return stream;
+    }
+
+    template <typename Real, size_t N>
+    constexpr const StaticPolynomial<Real, N> operator-(const StaticPolynomial<Real, N> &p)
+    {
+        StaticPolynomial<Real, N> res = p;
+        res *= -1.0;
+        return res;
+    }
+
+    template <typename Real, size_t N>
+    constexpr const StaticPolynomial<Real, N> operator+(const StaticPolynomial<Real, N> &p)
+    {
+        return p;
+    }
+
+    template <typename Real, size_t N, size_t M>
+    constexpr const StaticPolynomial<Real, std::max(N, M)> operator+(const StaticPolynomial<Real, N> &p1, const StaticPolynomial<Real, M> &p2)
+    {
+        StaticPolynomial<Real, std::max(N, M)> res;
+        res += p1;
+        res += p2;
+        return res;
+    }
+
+    template <typename Real, size_t N, typename Type>
+    constexpr const StaticPolynomial<Real, N> operator+(const StaticPolynomial<Real, N> &p, const Type &k)
+    {
+        StaticPolynomial<Real, N> res = p;
+        res += k;
+        return res;
+    }
+
+    template <typename Real, size_t N, typename Type>
+    constexpr const StaticPolynomial<Real, N> operator+(const Type &k, const StaticPolynomial<Real, N> &p)
+    {
+        StaticPolynomial<Real, N> res = p;
+        res += k;
+        return res;
+    }
+
+    template <typename Real, size_t N, size_t M>
+    constexpr const StaticPolynomial<Real, std::max(N, M)> operator-(const StaticPolynomial<Real, N> &p1, const StaticPolynomial<Real, M> &p2)
+    {
+        StaticPolynomial<Real, std::max(N, M)> res;
+        res += p1;
+        res -= p2;
+        return res;
+    }
+
+    template <typename Real, size_t N, typename Type>
+    constexpr const StaticPolynomial<Real, N> operator-(const StaticPolynomial<Real, N> &p, const Type &k)
+    {
+        StaticPolynomial<Real, N> res = p;
+        res -= k;
+        return res;
+    }
+
+    template <typename Real, size_t N, typename Type>
+    constexpr const StaticPolynomial<Real, N> operator-(const Type &k, const StaticPolynomial<Real, N> &p)
+    {
+        StaticPolynomial<Real, N> res = -p;
+        res += k;
+        return res;
+    }
+
+    template <typename Real, size_t N, size_t M>
+    constexpr const StaticPolynomial<Real, N + M> operator*(const StaticPolynomial<Real, N> &p1, const StaticPolynomial<Real, M> &p2)
+    {
+        StaticPolynomial<Real, N + M> res;
+        for (size_t i = 0; i <= N; i++)
+        {
+            for (size_t j = 0; j <= M; j++)
+            {
+                res[i + j] += p1[i] * p2[j];
+            }
+        }
+        return res;
+    }
+
+    template <typename Real, size_t N, typename Type>
+    constexpr const StaticPolynomial<Real, N> operator*(const Type &k, const StaticPolynomial<Real, N> &p)
+    {
+        StaticPolynomial<Real, N> res = p;
+        res *= k;
+        return res;
+    }
+
+    template <typename Real, size_t N, typename Type>
+    constexpr const StaticPolynomial<Real, N> operator*(const StaticPolynomial<Real, N> &p, const Type &k)
+    {
+        StaticPolynomial<Real, N> res = p;
+        res *= k;
+        return res;
+    }
+
+    template <typename Real, size_t N, typename Type>
+    constexpr const StaticPolynomial<Real, N> operator/(const StaticPolynomial<Real, N> &p, const Type &k)
+    {
+        StaticPolynomial<Real, N> res = p;
+        res /= k;
+        return res;
+    }
+
+    template <typename Real, size_t N, size_t M>
+    constexpr const bool operator==(const StaticPolynomial<Real, N> &p1, const StaticPolynomial<Real, M> &p2)
+    {
+        for (size_t i = 0; i <= std::max(N, M); i++)
+        {
+            if (p1[i] != p2[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename Real, size_t N, size_t M>
+    constexpr const bool operator!=(const StaticPolynomial<Real, N> &p1, const StaticPolynomial<Real, M> &p2)
+    {
+        return !(p1 == p2);
+    }
+
+    template <typename Real, size_t N>
+    inline std::ostream &operator<<(std::ostream &stream, const StaticPolynomial<Real, N> &p)
+    {
+        stream << p.print(Trait<float>::min());
+        return stream;
+    }
+
     template <typename Real>
     inline const std::vector<Polynomial<Real>> fundamentalPolynomial(const std::vector<Real> &x)
     {
@@ -237,30 +497,7 @@ namespace mtk
     template <typename Real>
     inline const Polynomial<Real> newtonFormula(const std::vector<Real> &x, const std::vector<Real> &y)
     {
-        const size_t n = x.size();
-        if (n != y.size())
-        {
-            printf("Error at: file %s line %d.\n", __FILE__, __LINE__);
-            exit(0);
-        }
-        std::vector<std::vector<Real>> table(n);
-        for (size_t i = 0; i < n; i++)
-        {
-            table[i].resize(i + 1);
-            table[i][0] = y[i];
-            for (size_t j = 0; j < i; j++)
-            {
-                table[i][j] = (table[i][j - 1] - table[i - 1][j - 1]) / (x[i] - x[i - j]);
-            }
-        }
-        Polynomial<Real> s(0);
-        Polynomial<Real> tmp({1});
-        for (size_t i = n; i > 0; i--)
-        {
-            s += table[i - 1][i] * tmp;
-            tmp *= Polynomial<Real>({-x[i - 1], 1});
-        }
-        return s;
+        return NewtonInterpolator<Real>(x, y).polynomial();
     }
 
     template <typename Real>
@@ -317,307 +554,1753 @@ namespace mtk
     }
 
     template <typename Real>
-    inline Polynomial<Real>::Polynomial(const size_t &n) : coefs(_coefs), degree(_degree)
-    {
-        if (n < 0)
-        {
-            printf("Error at: file %s line %d.\n", __FILE__, __LINE__);
-            exit(0);
-        }
-        _degree = n;
-        this->_coefs.resize(n + 1);
-        for (size_t i = 0; i <= n; i++)
-        {
-            this->_coefs[i] = 0;
-        }
-    }
-
-    template <typename Real>
-    inline Polynomial<Real>::Polynomial(const Polynomial &p) : coefs(_coefs), degree(_degree)
-    {
-        _degree = p.degree;
-        this->_coefs.assign(p.coefs.begin(), p.coefs.end());
-    }
-
-    template <typename Real>
-    inline Polynomial<Real>::Polynomial(const std::vector<Real> &coefs) : coefs(_coefs), degree(_degree)
+    inline const std::pair<Polynomial<Real>, Polynomial<Real>> divmod(const Polynomial<Real> &p1, const Polynomial<Real> &p2)
     {
-        _degree = coefs.size() - 1;
-        this->_coefs.assign(coefs.begin(), coefs.end());
+        return p1.divmod(p2);
     }
 
     template <typename Real>
-    inline const Polynomial<Real> Polynomial<Real>::differential() const
+    inline void Polynomial<Real>::schoolbook(const Real *a, const size_t &n, const Real *b, const size_t &m, Real *c)
     {
-        Polynomial res(degree - 1);
-        for (size_t i = 1; i <= degree; i++)
+        std::fill(c, c + n + m - 1, Real(0.0));
+        for (size_t i = 0; i < n; i++)
         {
-            res[i - 1] = (i * _coefs[i]);
+            const Real k = a[i];
+#pragma omp simd
+            for (size_t j = 0; j < m; j++)
+            {
+                c[i + j] += k * b[j];
+            }
         }
-        return res;
     }
 
     template <typename Real>
-    inline const Polynomial<Real> Polynomial<Real>::integral(const Real &x) const
+    inline void Polynomial<Real>::karatsuba(const Real *a, const Real *b, const size_t &n, Real *c)
     {
-        Polynomial res(degree + 1);
-        for (size_t i = 1; i <= degree; i++)
+        if (n <= _karatsuba)
         {
-            res[i + 1] = (_coefs[i] / (i + 1.0));
+            schoolbook(a, n, b, n, c);
+            return;
+        }
+        const size_t h = n / 2;
+        const size_t k = n - h;
+        std::vector<Real> sa(k), sb(k), z1(2 * k - 1);
+        for (size_t i = 0; i < k; i++)
+        {
+            sa[i] = a[h + i] + (i < h ? a[i] : Real(0.0));
+            sb[i] = b[h + i] + (i < h ? b[i] : Real(0.0));
+        }
+        karatsuba(a, b, h, c);
+        c[2 * h - 1] = 0.0;
+        karatsuba(a + h, b + h, k, c + 2 * h);
+        karatsuba(sa.data(), sb.data(), k, z1.data());
+        for (size_t i = 0; i < 2 * h - 1; i++)
+        {
+            z1[i] -= c[i];
+        }
+        for (size_t i = 0; i < 2 * k - 1; i++)
+        {
+            z1[i] -= c[2 * h + i];
+        }
+        for (size_t i = 0; i < 2 * k - 1; i++)
+        {
+            c[h + i] += z1[i];
         }
-        res[0] = res[0] - res(x);
-        return res;
     }
 
     template <typename Real>
-    inline const std::vector<Real> Polynomial<Real>::root(const Real &delta) const
+    inline void Polynomial<Real>::fft(std::vector<std::complex<Real>> &a, const bool &inverse)
     {
-        const size_t n = degree;
-        Matrix<Real> A = Matrix<Real>::Zero(n, n);
-        for (size_t i = 1; i < n; i++)
+        const size_t n = a.size();
+        for (size_t i = 1, j = 0; i < n; i++)
         {
-            A(i, i - 1) = 1.0;
+            size_t bit = n >> 1;
+            for (; j & bit; bit >>= 1)
+            {
+                j ^= bit;
+            }
+            j ^= bit;
+            if (i < j)
+            {
+                std::swap(a[i], a[j]);
+            }
         }
-        for (size_t i = 0; i < n; i++)
+        std::vector<std::complex<Real>> w(n / 2);
+        for (size_t i = 0; i < n / 2; i++)
         {
-            A(0, i) = -_coefs[n - i - 1] / _coefs[n];
+            const long double theta = (inverse ? 2.0L : -2.0L) * std::numbers::pi_v<long double> * i / n;
+            w[i] = std::complex<Real>(Real(std::cos(theta)), Real(std::sin(theta)));
         }
-        std::vector<Real> res;
-        Eigen::EigenSolver<Matrix<Real>> re(A);
-        Matrix<Real> D = re.pseudoEigenvalueMatrix();
-        for (size_t i = 0; i < n; i++)
+        for (size_t len = 2; len <= n; len <<= 1)
         {
-            if (std::abs(operator()(D(i, i))) < delta)
+            const size_t step = n / len;
+#pragma omp parallel for if (n >= (1 << 16))
+            for (size_t i = 0; i < n; i += len)
             {
-                res.push_back(D(i, i));
+                for (size_t j = 0; j < len / 2; j++)
+                {
+                    const std::complex<Real> u = a[i + j];
+                    const std::complex<Real> v = a[i + j + len / 2] * w[j * step];
+                    a[i + j] = u + v;
+                    a[i + j + len / 2] = u - v;
+                }
+            }
+        }
+        if (inverse)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                a[i] /= Real(n);
             }
         }
-        std::sort(res.begin(), res.end());
-        return res;
     }
 
     template <typename Real>
-    inline const bool Polynomial<Real>::isRoot(const Real &x, const Real &delta) const
+    inline void Polynomial<Real>::multiply(const Real *a, const size_t &n, const Real *b, const size_t &m, Real *c)
     {
-        return std::abs(operator()(x)) < delta;
-    }
-
-    template <typename Real>
-    inline const bool Polynomial<Real>::equal(const Polynomial &p, const Real &delta) const
+        if (n < m)
+        {
+            multiply(b, m, a, n, c);
+            return;
+        }
+        if (m < _karatsuba)
+        {
+            schoolbook(a, n, b, m, c);
+            return;
+        }
+        if constexpr (std::is_floating_point_v<Real>)
+        {
+            if (m >= _fft)
+            {
+                size_t size = 1;
+                while (size < n + m - 1)
+                {
+                    size <<= 1;
+                }
+                std::vector<std::complex<Real>> z(size);
+                for (size_t i = 0; i < size; i++)
+                {
+                    z[i] = std::complex<Real>(i < n ? a[i] : Real(0.0), i < m ? b[i] : Real(0.0));
+                }
+                fft(z, false);
+                std::vector<std::complex<Real>> y(size);
+                for (size_t i = 0; i < size; i++)
+                {
+                    const std::complex<Real> zi = z[i];
+                    const std::complex<Real> zj = std::conj(z[(size - i) & (size - 1)]);
+                    y[i] = (zi + zj) * (zi - zj) * std::complex<Real>(0.0, -0.25);
+                }
+                fft(y, true);
+                for (size_t i = 0; i < n + m - 1; i++)
+                {
+                    c[i] = y[i].real();
+                }
+                return;
+            }
+        }
+        std::fill(c, c + n + m - 1, Real(0.0));
+        std::vector<Real> chunk(m), tmp(2 * m - 1);
+        for (size_t i = 0; i < n; i += m)
+        {
+            const size_t l = std::min(m, n - i);
+            std::copy(a + i, a + i + l, chunk.begin());
+            std::fill(chunk.begin() + l, chunk.end(), Real(0.0));
+            karatsuba(chunk.data(), b, m, tmp.data());
+            for (size_t j = 0; j < std::min(2 * m - 1, n + m - 1 - i); j++)
+            {
+                c[i + j] += tmp[j];
+            }
+        }
+    }
+
+    template <typename Real>
+    inline const std::vector<Real> Polynomial<Real>::inverse(const std::vector<Real> &f, const size_t &k)
+    {
+        std::vector<Real> g({Real(1.0) / f[0]});
+        for (size_t l = 1; l < k;)
+        {
+            const size_t n = std::min(2 * l, k);
+            const size_t m = std::min(f.size(), n);
+            std::vector<Real> e(m + l - 1);
+            multiply(f.data(), m, g.data(), l, e.data());
+            e.resize(n, Real(0.0));
+            std::vector<Real> t(n - 1);
+            multiply(g.data(), l, e.data() + l, n - l, t.data());
+            g.resize(n);
+            for (size_t i = l; i < n; i++)
+            {
+                g[i] = -t[i - l];
+            }
+            l = n;
+        }
+        return g;
+    }
+
+    template <typename Real>
+    inline void Polynomial<Real>::shift(std::vector<Real> &q, const Real &t)
+    {
+        const size_t n = q.size();
+        for (size_t i = 0; i + 1 < n; i++)
+        {
+            for (size_t j = n - 1; j > i; j--)
+            {
+                q[j - 1] += t * q[j];
+            }
+        }
+    }
+
+    template <typename Real>
+    inline const size_t Polynomial<Real>::variation(const std::vector<Real> &q)
+    {
+        std::vector<Real> r(q.rbegin(), q.rend());
+        std::vector<Real> e(r.size());
+        std::transform(r.begin(), r.end(), e.begin(), [](const Real &x)
+                       { return std::abs(x); });
+        shift(r, 1.0);
+        shift(e, 1.0);
+        const Real eps = std::numeric_limits<Real>::epsilon() * r.size();
+        size_t res = 0;
+        int sign = 0;
+        for (size_t i = 0; i < r.size() && res < 2; i++)
+        {
+            if (std::abs(r[i]) <= eps * e[i] && r[i] != Real(0.0))
+            {
+                return 2;
+            }
+            const int s = (r[i] > 0) - (r[i] < 0);
+            if (s != 0)
+            {
+                res += (sign != 0 && s != sign);
+                sign = s;
+            }
+        }
+        return res;
+    }
+
+    template <typename Real>
+    inline void Polynomial<Real>::isolate(const std::vector<Real> &c, const Real &a, const Real &b, const size_t &depth, std::vector<std::pair<Real, Real>> &res)
+    {
+        std::vector<Real> q(c);
+        shift(q, a);
+        Real k = 1.0;
+        for (size_t i = 0; i < q.size(); i++, k *= (b - a))
+        {
+            q[i] *= k;
+        }
+        if (q[0] == Real(0.0))
+        {
+#pragma omp critical
+            res.push_back(std::make_pair(a, a));
+        }
+        while (q.size() > 1 && q[0] == Real(0.0))
+        {
+            q.erase(q.begin());
+        }
+        const size_t v = (q.size() > 1) ? variation(q) : 0;
+        if (v == 0)
+        {
+            return;
+        }
+        const Real m = a + (b - a) / 2;
+        const bool leaf = (depth == 0 || m <= a || m >= b);
+        if (v == 1 || leaf)
+        {
+            Real pa = 0.0, pb = 0.0;
+            for (size_t i = c.size(); i > 0; i--)
+            {
+                pa = pa * a + c[i - 1];
+                pb = pb * b + c[i - 1];
+            }
+            if ((v > 1 && leaf) || pa * pb < 0)
+            {
+#pragma omp critical
+                res.push_back(std::make_pair(a, b));
+                return;
+            }
+            if (leaf || pa * pb > 0)
+            {
+                return;
+            }
+        }
+#pragma omp task shared(c, res) if (c.size() > 16)
+        isolate(c, a, m, depth - 1, res);
+#pragma omp task shared(c, res) if (c.size() > 16)
+        isolate(c, m, b, depth - 1, res);
+#pragma omp taskwait
+    }
+
+    template <typename Real>
+    inline Polynomial<Real>::Polynomial(const size_t &n) : coefs(_coefs), degree(_degree)
+    {
+        if (n < 0)
+        {
+            printf("Error at: file %s line %d.\n", __FILE__, __LINE__);
+            exit(0);
+        }
+        _degree = n;
+        this->_coefs.resize(n + 1);
+        for (size_t i = 0; i <= n; i++)
+        {
+            this->_coefs[i] = 0;
+        }
+    }
+
+    template <typename Real>
+    inline Polynomial<Real>::Polynomial(const Polynomial &p) : coefs(_coefs), degree(_degree)
+    {
+        _degree = p.degree;
+        this->_coefs.assign(p.coefs.begin(), p.coefs.end());
+    }
+
+    template <typename Real>
+    inline Polynomial<Real>::Polynomial(const std::vector<Real> &coefs) : coefs(_coefs), degree(_degree)
+    {
+        _degree = coefs.size() - 1;
+        this->_coefs.assign(coefs.begin(), coefs.end());
+    }
+
+    template <typename Real>
+    inline Polynomial<Real>::Polynomial(const SparsePolynomial<Real> &p) : Polynomial(p.degree)
+    {
+        for (size_t i = 0; i < p.terms.size(); i++)
+        {
+            _coefs[p.terms[i].first] = p.terms[i].second;
+        }
+    }
+
+    template <typename Real>
+    template <size_t N>
+    inline Polynomial<Real>::Polynomial(const StaticPolynomial<Real, N> &p) : Polynomial(N)
+    {
+        for (size_t i = 0; i <= N; i++)
+        {
+            _coefs[i] = p[i];
+        }
+    }
+
+    template <typename Real>
+    inline const Polynomial<Real> Polynomial<Real>::differential() const
+    {
+        Polynomial res(degree - 1);
+        for (size_t i = 1; i <= degree; i++)
+        {
+            res[i - 1] = (i * _coefs[i]);
+        }
+        return res;
+    }
+
+    template <typename Real>
+    inline const Polynomial<Real> Polynomial<Real>::integral(const Real &x) const
+    {
+        Polynomial res(degree + 1);
+        for (size_t i = 0; i <= degree; i++)
+        {
+            res[i + 1] = (_coefs[i] / (i + 1.0));
+        }
+        res[0] = res[0] - res(x);
+        return res;
+    }
+
+    template <typename Real>
+    inline const std::vector<Real> Polynomial<Real>::root(const Real &delta) const
+    {
+        std::vector<Real> res;
+        const std::vector<Root> z = complexRoot();
+        for (size_t i = 0; i < z.size(); i++)
+        {
+            if (std::abs(z[i].value.imag()) > z[i].error)
+            {
+                continue;
+            }
+            Real x = z[i].value.real();
+            for (size_t j = 0; j < 8 && z[i].multiplicity == 1; j++)
+            {
+                const std::vector<Real> d = derivatives(x, 1);
+                if (d[1] == Real(0.0))
+                {
+                    break;
+                }
+                const Real step = d[0] / d[1];
+                x -= step;
+                if (std::abs(step) <= Trait<Real>::epsilon() * std::abs(x))
+                {
+                    break;
+                }
+            }
+            if (std::abs(operator()(x)) < delta)
+            {
+                res.insert(res.end(), z[i].multiplicity, x);
+            }
+        }
+        std::sort(res.begin(), res.end());
+        return res;
+    }
+
+    template <typename Real>
+    inline const std::vector<typename Polynomial<Real>::Root> Polynomial<Real>::complexRoot(const size_t &max_iteration) const
+    {
+        using Complex = std::complex<Real>;
+        std::vector<Root> res;
+        size_t high = degree;
+        while (high > 0 && _coefs[high] == Real(0.0))
+        {
+            high--;
+        }
+        size_t low = 0;
+        while (low < high && _coefs[low] == Real(0.0))
+        {
+            low++;
+        }
+        if (low > 0)
+        {
+            res.push_back(Root({Complex(0.0, 0.0), Real(0.0), low}));
+        }
+        const size_t n = high - low;
+        if (n == 0)
+        {
+            return res;
+        }
+        const std::vector<Real> c(_coefs.begin() + low, _coefs.begin() + high + 1);
+        const auto newton = [&c, &n](const Complex &z) -> std::tuple<Complex, Real, Real>
+        {
+            const bool reverse = std::abs(z) > 1.0;
+            const Complex w = reverse ? Real(1.0) / z : z;
+            const Real r = std::abs(w);
+            Complex p = c[reverse ? 0 : n];
+            Complex d = 0.0;
+            Real bound = std::abs(p);
+            for (size_t i = n; i > 0; i--)
+            {
+                const Real k = c[reverse ? n - i + 1 : i - 1];
+                d = d * w + p;
+                p = p * w + k;
+                bound = bound * r + std::abs(k);
+            }
+            const Complex q = reverse ? w * (Real(n) * p - w * d) : d;
+            return std::make_tuple(p / q, std::abs(p) / bound, 2 * n * Trait<Real>::epsilon() * bound / std::abs(q));
+        };
+        const Real radius = std::pow(std::abs(c[0] / c[n]), Real(1.0) / n);
+        std::vector<Complex> z(n), step(n);
+        std::vector<bool> done(n, false);
+        for (size_t i = 0; i < n; i++)
+        {
+            z[i] = std::polar(radius, Real(2.0 * std::numbers::pi_v<long double> * i / n + 0.4));
+        }
+        for (size_t iteration = 0; iteration < max_iteration; iteration++)
+        {
+            bool finish = true;
+#pragma omp parallel for reduction(&& : finish)
+            for (size_t i = 0; i < n; i++)
+            {
+                step[i] = 0.0;
+                if (done[i])
+                {
+                    continue;
+                }
+                const auto [ratio, error, rounding] = newton(z[i]);
+                if (error <= 4 * n * Trait<Real>::epsilon())
+                {
+                    continue;
+                }
+                Complex s = 0.0;
+                for (size_t j = 0; j < n; j++)
+                {
+                    if (j != i)
+                    {
+                        s += Real(1.0) / (z[i] - z[j]);
+                    }
+                }
+                step[i] = ratio / (Real(1.0) - ratio * s);
+                finish = false;
+            }
+            if (finish)
+            {
+                break;
+            }
+            for (size_t i = 0; i < n; i++)
+            {
+                z[i] -= step[i];
+                done[i] = (step[i] == Complex(0.0, 0.0)) || std::abs(step[i]) <= Trait<Real>::epsilon() * std::abs(z[i]);
+            }
+        }
+        std::vector<Real> error(n);
+#pragma omp parallel for
+        for (size_t i = 0; i < n; i++)
+        {
+            const auto [ratio, residual, rounding] = newton(z[i]);
+            error[i] = n * (std::abs(ratio) + rounding) + Trait<Real>::epsilon() * std::abs(z[i]);
+        }
+        std::vector<size_t> group(n);
+        for (size_t i = 0; i < n; i++)
+        {
+            group[i] = i;
+        }
+        const std::function<size_t(size_t)> find = [&group, &find](size_t i) -> size_t
+        {
+            return (group[i] == i) ? i : (group[i] = find(group[i]));
+        };
+        for (size_t i = 0; i < n; i++)
+        {
+            for (size_t j = i + 1; j < n; j++)
+            {
+                if (std::abs(z[i] - z[j]) <= error[i] + error[j])
+                {
+                    group[find(i)] = find(j);
+                }
+            }
+        }
+        std::vector<std::vector<size_t>> cluster(n);
+        for (size_t i = 0; i < n; i++)
+        {
+            cluster[find(i)].push_back(i);
+        }
+        for (size_t i = 0; i < n; i++)
+        {
+            if (cluster[i].empty())
+            {
+                continue;
+            }
+            Complex center = 0.0;
+            for (const size_t &j : cluster[i])
+            {
+                center += z[j];
+            }
+            center /= Real(cluster[i].size());
+            Real r = 0.0;
+            for (const size_t &j : cluster[i])
+            {
+                r = std::max(r, std::abs(z[j] - center) + error[j]);
+            }
+            res.push_back(Root({center, r, cluster[i].size()}));
+        }
+        return res;
+    }
+
+    template <typename Real>
+    inline const std::vector<std::pair<Real, Real>> Polynomial<Real>::isolate(const Real &min, const Real &max) const
+    {
+        size_t n = degree;
+        while (n > 0 && _coefs[n] == Real(0.0))
+        {
+            n--;
+        }
+        const std::vector<Real> c(_coefs.begin(), _coefs.begin() + n + 1);
+        std::vector<std::pair<Real, Real>> res;
+        if (operator()(max) == Real(0.0))
+        {
+            res.push_back(std::make_pair(max, max));
+        }
+#pragma omp parallel
+#pragma omp single
+        isolate(c, min, max, std::numeric_limits<Real>::digits, res);
+        std::sort(res.begin(), res.end());
+        std::vector<std::pair<Real, Real>> interval;
+        bool zero = false;
+        for (size_t i = 0; i < res.size(); i++)
+        {
+            if (zero && res[i].first == res[i].second)
+            {
+                const Real x = interval.back().second + (res[i].first - interval.back().second) / 2;
+                Real y = 0.0, e = 0.0;
+                for (size_t j = c.size(); j > 0; j--)
+                {
+                    y = y * x + c[j - 1];
+                    e = e * std::abs(x) + std::abs(c[j - 1]);
+                }
+                if (std::abs(y) <= c.size() * Trait<Real>::epsilon() * e)
+                {
+                    interval.back().second = res[i].second;
+                    continue;
+                }
+            }
+            zero = (res[i].first == res[i].second);
+            interval.push_back(res[i]);
+        }
+        return interval;
+    }
+
+    template <typename Real>
+    inline const std::vector<Real> Polynomial<Real>::root(const Real &min, const Real &max, const Real &delta) const
+    {
+        const std::vector<std::pair<Real, Real>> interval = isolate(min, max);
+        std::vector<Real> res(interval.size());
+        std::vector<size_t> multiplicity(interval.size(), 1);
+#pragma omp parallel for
+        for (size_t i = 0; i < interval.size(); i++)
+        {
+            Real l = interval[i].first;
+            Real r = interval[i].second;
+            Real fl = operator()(l);
+            const Real fr = operator()(r);
+            Real x = l + (r - l) / 2;
+            const bool bracket = (fl < 0) != (fr < 0);
+            for (size_t j = 0; j < std::numeric_limits<Real>::digits && l < r; j++)
+            {
+                const std::vector<Real> d = derivatives(x, 1);
+                if (d[0] == Real(0.0))
+                {
+                    break;
+                }
+                if (bracket && (d[0] < 0) == (fl < 0))
+                {
+                    l = x;
+                    fl = d[0];
+                }
+                else if (bracket)
+                {
+                    r = x;
+                }
+                Real y = (d[1] != Real(0.0)) ? x - d[0] / d[1] : l + (r - l) / 2;
+                if (!(y > l && y < r))
+                {
+                    y = l + (r - l) / 2;
+                }
+                if (std::abs(y - x) <= Trait<Real>::epsilon() * std::abs(x))
+                {
+                    x = y;
+                    break;
+                }
+                x = y;
+            }
+            res[i] = x;
+            const std::vector<Real> d = derivatives(x, 2);
+            Real e = 0.0;
+            for (size_t k = degree; k > 0; k--)
+            {
+                e = e * std::abs(x) + k * std::abs(_coefs[k]);
+            }
+            const bool simple = std::abs(d[1]) > (degree + 1) * Trait<Real>::epsilon() * e &&
+                                std::abs(d[1]) > std::sqrt(Trait<float>::epsilon()) * std::max(Real(1.0), std::abs(x)) * std::abs(d[2]);
+            multiplicity[i] = simple ? 1 : 0;
+        }
+        std::vector<Root> z;
+        for (size_t i = 0; i < res.size(); i++)
+        {
+            if (multiplicity[i] > 0)
+            {
+                continue;
+            }
+            std::vector<Real> q(_coefs);
+            shift(q, res[i]);
+            while (multiplicity[i] < degree && q[multiplicity[i]] == Real(0.0))
+            {
+                multiplicity[i]++;
+            }
+            if (multiplicity[i] > 1)
+            {
+                continue;
+            }
+            if (z.empty())
+            {
+                z = complexRoot();
+            }
+            Real distance = std::numeric_limits<Real>::infinity();
+            multiplicity[i] = 1;
+            for (size_t j = 0; j < z.size(); j++)
+            {
+                const Real d = std::abs(z[j].value - std::complex<Real>(res[i], 0.0));
+                if (d <= z[j].error + (interval[i].second - interval[i].first) && d < distance)
+                {
+                    distance = d;
+                    multiplicity[i] = z[j].multiplicity;
+                }
+            }
+        }
+        std::vector<Real> root;
+        for (size_t i = 0; i < res.size(); i++)
+        {
+            if (std::abs(operator()(res[i])) < delta)
+            {
+                root.insert(root.end(), multiplicity[i], res[i]);
+            }
+        }
+        return root;
+    }
+
+    template <typename Real>
+    inline const bool Polynomial<Real>::isRoot(const Real &x, const Real &delta) const
+    {
+        return std::abs(operator()(x)) < delta;
+    }
+
+    template <typename Real>
+    inline const std::pair<Polynomial<Real>, Polynomial<Real>> Polynomial<Real>::divmod(const Polynomial &p) const
+    {
+        size_t m = p.degree;
+        while (m > 0 && p[m] == Real(0.0))
+        {
+            m--;
+        }
+        if (p[m] == Real(0.0))
+        {
+            printf("Error at: file %s line %d.\n", __FILE__, __LINE__);
+            exit(0);
+        }
+        const size_t n = degree;
+        if (n < m)
+        {
+            return std::make_pair(Polynomial(0), *this);
+        }
+        const size_t k = n - m + 1;
+        std::vector<Real> q(k), r;
+        if (m < _karatsuba || k < _karatsuba)
+        {
+            r = _coefs;
+            for (size_t i = k; i > 0; i--)
+            {
+                const Real c = r[i - 1 + m] / p[m];
+                q[i - 1] = c;
+#pragma omp simd
+                for (size_t j = 0; j <= m; j++)
+                {
+                    r[i - 1 + j] -= c * p.coefs[j];
+                }
+            }
+        }
+        else
+        {
+            std::vector<Real> ra(k), rb(std::min(m + 1, k));
+            for (size_t i = 0; i < k; i++)
+            {
+                ra[i] = _coefs[n - i];
+            }
+            for (size_t i = 0; i < rb.size(); i++)
+            {
+                rb[i] = p.coefs[m - i];
+            }
+            const std::vector<Real> g = inverse(rb, k);
+            std::vector<Real> t(2 * k - 1);
+            multiply(ra.data(), k, g.data(), k, t.data());
+            for (size_t i = 0; i < k; i++)
+            {
+                q[k - 1 - i] = t[i];
+            }
+            r.resize(n + 1);
+            multiply(q.data(), k, p.coefs.data(), m + 1, r.data());
+            for (size_t i = 0; i < m; i++)
+            {
+                r[i] = _coefs[i] - r[i];
+            }
+        }
+        r.resize(std::max<size_t>(m, 1));
+        if (m == 0)
+        {
+            r[0] = 0.0;
+        }
+        return std::make_pair(Polynomial(q), Polynomial(r));
+    }
+
+    template <typename Real>
+    inline const Real Polynomial<Real>::horner(const Real &x) const
+    {
+        Real res = _coefs[degree];
+        for (size_t i = degree; i > 0; i--)
+        {
+            res = res * x + _coefs[i - 1];
+        }
+        return res;
+    }
+
+    template <typename Real>
+    inline const Real Polynomial<Real>::estrin(const Real &x) const
+    {
+        const Real x2 = x * x;
+        const Real x4 = x2 * x2;
+        const Real x8 = x4 * x4;
+        const size_t n = (degree + 1) / 8;
+        Real res = 0.0;
+        for (size_t i = degree + 1; i > 8 * n; i--)
+        {
+            res = res * x + _coefs[i - 1];
+        }
+        for (size_t j = n; j > 0; j--)
+        {
+            const Real *c = _coefs.data() + 8 * (j - 1);
+            const Real q = ((c[0] + c[1] * x) + x2 * (c[2] + c[3] * x)) + x4 * ((c[4] + c[5] * x) + x2 * (c[6] + c[7] * x));
+            res = res * x8 + q;
+        }
+        return res;
+    }
+
+    template <typename Real>
+    inline const std::vector<Real> Polynomial<Real>::derivatives(const Real &x, const size_t &k) const
+    {
+        std::vector<Real> res(k + 1, Real(0.0));
+        res[0] = _coefs[degree];
+        for (size_t i = degree; i > 0; i--)
+        {
+            for (size_t j = std::min(k, degree - i + 1); j > 0; j--)
+            {
+                res[j] = res[j] * x + res[j - 1];
+            }
+            res[0] = res[0] * x + _coefs[i - 1];
+        }
+        Real factor = 1.0;
+        for (size_t j = 2; j <= k; j++)
+        {
+            factor *= j;
+            res[j] *= factor;
+        }
+        return res;
+    }
+
+    template <typename Real>
+    inline void Polynomial<Real>::evaluate(const Real *first, const Real *last, Real *res) const
+    {
+        const size_t n = last - first;
+#pragma omp parallel for if (n * degree >= (1 << 20))
+        for (size_t b = 0; b < n; b += _block)
+        {
+            const size_t m = std::min(_block, n - b);
+            const Real *x = first + b;
+            Real *y = res + b;
+            Real acc[_block];
+#pragma omp simd
+            for (size_t j = 0; j < m; j++)
+            {
+                acc[j] = _coefs[degree];
+            }
+            for (size_t i = degree; i > 0; i--)
+            {
+                const Real c = _coefs[i - 1];
+#pragma omp simd
+                for (size_t j = 0; j < m; j++)
+                {
+                    acc[j] = acc[j] * x[j] + c;
+                }
+            }
+            std::copy(acc, acc + m, y);
+        }
+    }
+
+    template <typename Real>
+    inline const std::vector<Real> Polynomial<Real>::evaluate(const std::vector<Real> &x) const
+    {
+        std::vector<Real> res(x.size());
+        evaluate(x.data(), x.data() + x.size(), res.data());
+        return res;
+    }
+
+    template <typename Real>
+    inline const Vector<Real> Polynomial<Real>::evaluate(const Vector<Real> &x) const
+    {
+        Vector<Real> res(x.size());
+        evaluate(x.data(), x.data() + x.size(), res.data());
+        return res;
+    }
+
+    template <typename Real>
+    inline const bool Polynomial<Real>::equal(const Polynomial &p, const Real &delta) const
+    {
+        int n = std::max(p.degree, degree);
+        for (size_t i = 0; i <= n; i++)
+        {
+            if (std::abs(p[i] - this->_coefs[i]) > delta)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename Real>
+    inline std::string Polynomial<Real>::print(const Real &precision) const
+    {
+        std::string s = "";
+        bool flag = true;
+        for (size_t i = degree; i > 0; i--)
+        {
+            if (std::abs(_coefs[i]) > precision)
+            {
+                s += ((_coefs[i] > 0 ? (i == degree ? "" : "+ ") : "- ") + std::to_string(std::abs(_coefs[i])));
+                s += (" x^" + std::to_string(i) + " ");
+                flag = false;
+            }
+        }
+        if (flag)
+        {
+            s += std::to_string(_coefs[0]);
+        }
+        else if (std::abs(_coefs[0]) > precision)
+        {
+            s += ((_coefs[0] > 0 ? "+ " : "- ") + std::to_string(std::abs(_coefs[0])));
+        }
+        return s;
+    }
+
+    template <typename Real>
+    inline Polynomial<Real> &Polynomial<Real>::operator=(const Polynomial &p)
+    {
+        if (&p != this)
+        {
+            this->_degree = p.degree;
+            this->_coefs = p.coefs;
+        }
+        return (*this);
+    }
+
+    template <typename Real>
+    inline Polynomial<Real> &Polynomial<Real>::operator=(const Real &k)
+    {
+        this->_degree = 0;
+        this->_coefs.resize(1);
+        this->_coefs[0] = k;
+        return (*this);
+    }
+
+    template <typename Real>
+    inline Polynomial<Real> &Polynomial<Real>::operator+=(const Polynomial &p)
+    {
+        _degree = (std::max(degree, p.degree));
+        _coefs.resize(_degree + 1, Trait<Real>::zero());
+        for (size_t i = 0; i <= p.degree; i++)
+        {
+            _coefs[i] += p[i];
+        }
+        return (*this);
+    }
+
+    template <typename Real>
+    inline Polynomial<Real> &Polynomial<Real>::operator+=(const Real &k)
+    {
+        _coefs[0] += k;
+        return (*this);
+    }
+
+    template <typename Real>
+    inline Polynomial<Real> &Polynomial<Real>::operator-=(const Polynomial &p)
+    {
+        _degree = (std::max(degree, p.degree));
+        _coefs.resize(_degree + 1, Trait<Real>::zero());
+        for (size_t i = 0; i <= p.degree; i++)
+        {
+            _coefs[i] -= p[i];
+        }
+        return (*this);
+    }
+
+    template <typename Real>
+    inline Polynomial<Real> &Polynomial<Real>::operator-=(const Real &k)
+    {
+        _coefs[0] -= k;
+        return (*this);
+    }
+
+    template <typename Real>
+    inline Polynomial<Real> &Polynomial<Real>::operator*=(const Polynomial &p)
+    {
+        std::vector<Real> res(degree + p.degree + 1);
+        multiply(_coefs.data(), degree + 1, p.coefs.data(), p.degree + 1, res.data());
+        _degree = res.size() - 1;
+        _coefs.swap(res);
+        return (*this);
+    }
+
+    template <typename Real>
+    inline Polynomial<Real> &Polynomial<Real>::operator*=(const Real &k)
+    {
+        for (size_t i = 0; i <= degree; i++)
+        {
+            _coefs[i] *= k;
+        }
+        return (*this);
+    }
+
+    template <typename Real>
+    inline Polynomial<Real> &Polynomial<Real>::operator/=(const Real &k)
+    {
+        for (size_t i = 0; i <= degree; i++)
+        {
+            _coefs[i] /= k;
+        }
+        return (*this);
+    }
+
+    template <typename Real>
+    inline Polynomial<Real> &Polynomial<Real>::operator/=(const Polynomial<Real> &p)
+    {
+        (*this) = divmod(p).first;
+        return (*this);
+    }
+
+    template <typename Real>
+    inline Polynomial<Real> &Polynomial<Real>::operator%=(const Polynomial<Real> &p)
+    {
+        (*this) = divmod(p).second;
+        return (*this);
+    }
+
+    template <typename Real>
+    inline const Real Polynomial<Real>::operator()(const Real &x) const
+    {
+        return (degree >= _estrin) ? estrin(x) : horner(x);
+    }
+
+    template <typename Real>
+    inline const Real Polynomial<Real>::operator[](const size_t &n) const
+    {
+        if (n > degree)
+        {
+            return 0.0;
+        }
+        return this->_coefs[n];
+    }
+
+    template <typename Real>
+    inline Real &Polynomial<Real>::operator[](const size_t &n)
+    {
+        if (n > degree)
+        {
+            printf("Error at: file %s line %d.\n", __FILE__, __LINE__);
+            exit(0);
+        }
+        return this->_coefs[n];
+    }
+
+    template <typename Real>
+    inline const Polynomial<Real> Trait<Polynomial<Real>>::zero()
+    {
+        return Polynomial<Real>(Trait<Real>::zero());
+    }
+
+    template <typename Real>
+    inline const Polynomial<Real> Trait<Polynomial<Real>>::identity()
+    {
+        return Polynomial<Real>(std::vector<Real>({Trait<Real>::identity()}));
+    }
+
+    template <typename Real>
+    inline const Polynomial<Real> Trait<Polynomial<Real>>::basis(const size_t &n)
+    {
+        Polynomial<Real> p(n);
+        p[n] = Trait<Real>::identity();
+        return p;
+    }
+
+    template <typename Real>
+    inline const Real SparsePolynomial<Real>::power(const Real &x, const size_t &n)
+    {
+        Real res = 1.0, base = x;
+        for (size_t k = n; k > 0; k >>= 1)
+        {
+            if (k & 1)
+            {
+                res *= base;
+            }
+            base *= base;
+        }
+        return res;
+    }
+
+    template <typename Real>
+    inline void SparsePolynomial<Real>::normalize()
+    {
+        std::sort(_terms.begin(), _terms.end(), [](const std::pair<size_t, Real> &a, const std::pair<size_t, Real> &b)
+                  { return a.first < b.first; });
+        size_t n = 0;
+        for (size_t i = 0; i < _terms.size(); i++)
+        {
+            if (n > 0 && _terms[n - 1].first == _terms[i].first)
+            {
+                _terms[n - 1].second += _terms[i].second;
+            }
+            else
+            {
+                _terms[n++] = _terms[i];
+            }
+            if (_terms[n - 1].second == Real(0.0))
+            {
+                n--;
+            }
+        }
+        _terms.resize(n);
+        _degree = _terms.empty() ? 0 : _terms.back().first;
+    }
+
+    template <typename Real>
+    inline SparsePolynomial<Real>::SparsePolynomial() : terms(_terms), degree(_degree)
+    {
+        _degree = 0;
+    }
+
+    template <typename Real>
+    inline SparsePolynomial<Real>::SparsePolynomial(const SparsePolynomial &p) : terms(_terms), degree(_degree)
+    {
+        _degree = p.degree;
+        _terms = p.terms;
+    }
+
+    template <typename Real>
+    inline SparsePolynomial<Real>::SparsePolynomial(const std::vector<std::pair<size_t, Real>> &terms) : terms(_terms), degree(_degree)
+    {
+        _terms = terms;
+        normalize();
+    }
+
+    template <typename Real>
+    inline SparsePolynomial<Real>::SparsePolynomial(const Polynomial<Real> &p) : terms(_terms), degree(_degree)
+    {
+        for (size_t i = 0; i <= p.degree; i++)
+        {
+            if (p[i] != Real(0.0))
+            {
+                _terms.push_back(std::make_pair(i, p[i]));
+            }
+        }
+        _degree = _terms.empty() ? 0 : _terms.back().first;
+    }
+
+    template <typename Real>
+    inline const SparsePolynomial<Real> SparsePolynomial<Real>::differential() const
+    {
+        SparsePolynomial res;
+        for (size_t i = 0; i < _terms.size(); i++)
+        {
+            if (_terms[i].first > 0)
+            {
+                res._terms.push_back(std::make_pair(_terms[i].first - 1, _terms[i].first * _terms[i].second));
+            }
+        }
+        res._degree = res._terms.empty() ? 0 : res._terms.back().first;
+        return res;
+    }
+
+    template <typename Real>
+    inline const SparsePolynomial<Real> SparsePolynomial<Real>::integral(const Real &x) const
+    {
+        SparsePolynomial res;
+        res._terms.push_back(std::make_pair(size_t(0), Real(0.0)));
+        for (size_t i = 0; i < _terms.size(); i++)
+        {
+            res._terms.push_back(std::make_pair(_terms[i].first + 1, _terms[i].second / (_terms[i].first + 1.0)));
+        }
+        res._terms[0].second = -res(x);
+        res.normalize();
+        return res;
+    }
+
+    template <typename Real>
+    inline const bool SparsePolynomial<Real>::equal(const SparsePolynomial &p, const Real &delta) const
+    {
+        const SparsePolynomial res = (*this) - p;
+        for (size_t i = 0; i < res.terms.size(); i++)
+        {
+            if (std::abs(res.terms[i].second) > delta)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename Real>
+    inline std::string SparsePolynomial<Real>::print(const Real &precision) const
+    {
+        std::string s = "";
+        bool flag = true;
+        for (size_t i = _terms.size(); i > 0; i--)
+        {
+            const size_t n = _terms[i - 1].first;
+            const Real c = _terms[i - 1].second;
+            if (std::abs(c) > precision)
+            {
+                s += ((c > 0 ? (flag ? "" : "+ ") : "- ") + std::to_string(std::abs(c)));
+                s += ((n > 0) ? (" x^" + std::to_string(n) + " ") : "");
+                flag = false;
+            }
+        }
+        if (flag)
+        {
+            s += std::to_string(Real(0.0));
+        }
+        return s;
+    }
+
+    template <typename Real>
+    inline SparsePolynomial<Real> &SparsePolynomial<Real>::operator=(const SparsePolynomial &p)
+    {
+        if (&p != this)
+        {
+            this->_degree = p.degree;
+            this->_terms = p.terms;
+        }
+        return (*this);
+    }
+
+    template <typename Real>
+    inline SparsePolynomial<Real> &SparsePolynomial<Real>::operator=(const Real &k)
+    {
+        _terms.assign(1, std::make_pair(size_t(0), k));
+        normalize();
+        return (*this);
+    }
+
+    template <typename Real>
+    inline SparsePolynomial<Real> &SparsePolynomial<Real>::operator+=(const SparsePolynomial &p)
+    {
+        _terms.insert(_terms.end(), p.terms.begin(), p.terms.end());
+        normalize();
+        return (*this);
+    }
+
+    template <typename Real>
+    inline SparsePolynomial<Real> &SparsePolynomial<Real>::operator+=(const Real &k)
+    {
+        _terms.push_back(std::make_pair(size_t(0), k));
+        normalize();
+        return (*this);
+    }
+
+    template <typename Real>
+    inline SparsePolynomial<Real> &SparsePolynomial<Real>::operator-=(const SparsePolynomial &p)
+    {
+        for (size_t i = 0; i < p.terms.size(); i++)
+        {
+            _terms.push_back(std::make_pair(p.terms[i].first, -p.terms[i].second));
+        }
+        normalize();
+        return (*this);
+    }
+
+    template <typename Real>
+    inline SparsePolynomial<Real> &SparsePolynomial<Real>::operator-=(const Real &k)
+    {
+        _terms.push_back(std::make_pair(size_t(0), -k));
+        normalize();
+        return (*this);
+    }
+
+    template <typename Real>
+    inline SparsePolynomial<Real> &SparsePolynomial<Real>::operator*=(const SparsePolynomial &p)
+    {
+        std::vector<std::pair<size_t, Real>> res(_terms.size() * p.terms.size());
+#pragma omp parallel for if (res.size() > 4096)
+        for (size_t i = 0; i < _terms.size(); i++)
+        {
+            for (size_t j = 0; j < p.terms.size(); j++)
+            {
+                res[i * p.terms.size() + j] = std::make_pair(_terms[i].first + p.terms[j].first, _terms[i].second * p.terms[j].second);
+            }
+        }
+        _terms.swap(res);
+        normalize();
+        return (*this);
+    }
+
+    template <typename Real>
+    inline SparsePolynomial<Real> &SparsePolynomial<Real>::operator*=(const Real &k)
     {
-        int n = std::max(p.degree, degree);
-        for (size_t i = 0; i <= n; i++)
+        for (size_t i = 0; i < _terms.size(); i++)
         {
-            if (std::abs(p[i] - this->_coefs[i]) > delta)
-            {
-                return false;
-            }
+            _terms[i].second *= k;
         }
-        return true;
+        normalize();
+        return (*this);
     }
 
     template <typename Real>
-    inline std::string Polynomial<Real>::print(const Real &precision) const
+    inline SparsePolynomial<Real> &SparsePolynomial<Real>::operator/=(const Real &k)
     {
-        std::string s = "";
-        bool flag = true;
-        for (size_t i = degree; i > 0; i--)
+        for (size_t i = 0; i < _terms.size(); i++)
         {
-            if (std::abs(_coefs[i]) > precision)
-            {
-                s += ((_coefs[i] > 0 ? (i == degree ? "" : "+ ") : "- ") + std::to_string(std::abs(_coefs[i])));
-                s += (" x^" + std::to_string(i) + " ");
-                flag = false;
-            }
+            _terms[i].second /= k;
         }
-        if (flag)
+        normalize();
+        return (*this);
+    }
+
+    template <typename Real>
+    inline const Real SparsePolynomial<Real>::operator()(const Real &x) const
+    {
+        if (_terms.empty())
         {
-            s += std::to_string(_coefs[0]);
+            return 0.0;
         }
-        else if (std::abs(_coefs[0]) > precision)
+        Real res = 0.0;
+        size_t n = _terms.back().first;
+        for (size_t i = _terms.size(); i > 0; i--)
         {
-            s += ((_coefs[0] > 0 ? "+ " : "- ") + std::to_string(std::abs(_coefs[0])));
+            res = res * power(x, n - _terms[i - 1].first) + _terms[i - 1].second;
+            n = _terms[i - 1].first;
         }
-        return s;
+        return res * power(x, n);
     }
 
     template <typename Real>
-    inline Polynomial<Real> &Polynomial<Real>::operator=(const Polynomial &p)
+    inline const Real SparsePolynomial<Real>::operator[](const size_t &n) const
     {
-        if (&p != this)
+        auto it = std::lower_bound(_terms.begin(), _terms.end(), n, [](const std::pair<size_t, Real> &a, const size_t &b)
+                                   { return a.first < b; });
+        if (it == _terms.end() || it->first != n)
         {
-            this->_degree = p.degree;
-            this->_coefs = p.coefs;
+            return 0.0;
         }
-        return (*this);
+        return it->second;
     }
 
     template <typename Real>
-    inline Polynomial<Real> &Polynomial<Real>::operator=(const Real &k)
+    inline typename SparsePolynomial<Real>::Coefficient SparsePolynomial<Real>::operator[](const size_t &n)
     {
-        this->_degree = 0;
-        this->_coefs.resize(1);
-        this->_coefs[0] = k;
+        return Coefficient(this, n);
+    }
+
+    template <typename Real>
+    inline SparsePolynomial<Real>::Coefficient::Coefficient(SparsePolynomial *p, const size_t &n) : _p(p), _n(n) {}
+
+    template <typename Real>
+    inline SparsePolynomial<Real>::Coefficient::operator Real() const
+    {
+        return static_cast<const SparsePolynomial &>(*_p)[_n];
+    }
+
+    template <typename Real>
+    inline typename SparsePolynomial<Real>::Coefficient &SparsePolynomial<Real>::Coefficient::operator=(const Real &k)
+    {
+        std::vector<std::pair<size_t, Real>> &terms = _p->_terms;
+        auto it = std::lower_bound(terms.begin(), terms.end(), _n, [](const std::pair<size_t, Real> &a, const size_t &b)
+                                   { return a.first < b; });
+        if (it != terms.end() && it->first == _n)
+        {
+            it->second = k;
+        }
+        else
+        {
+            terms.insert(it, std::make_pair(_n, k));
+        }
+        _p->normalize();
         return (*this);
     }
 
     template <typename Real>
-    inline Polynomial<Real> &Polynomial<Real>::operator+=(const Polynomial &p)
+    inline const SparsePolynomial<Real> Trait<SparsePolynomial<Real>>::zero()
+    {
+        return SparsePolynomial<Real>();
+    }
+
+    template <typename Real>
+    inline const SparsePolynomial<Real> Trait<SparsePolynomial<Real>>::identity()
+    {
+        return SparsePolynomial<Real>({std::make_pair(size_t(0), Trait<Real>::identity())});
+    }
+
+    template <typename Real>
+    inline const SparsePolynomial<Real> Trait<SparsePolynomial<Real>>::basis(const size_t &n)
+    {
+        return SparsePolynomial<Real>({std::make_pair(n, Trait<Real>::identity())});
+    }
+
+    template <typename Real, size_t N>
+    template <size_t... I>
+    constexpr const Real StaticPolynomial<Real, N>::horner(const Real &x, std::index_sequence<I...>) const
+    {
+        Real res = _coefs[N];
+        ((res = res * x + _coefs[N - 1 - I]), ...);
+        return res;
+    }
+
+    template <typename Real, size_t N>
+    constexpr StaticPolynomial<Real, N>::StaticPolynomial() : _coefs{} {}
+
+    template <typename Real, size_t N>
+    constexpr StaticPolynomial<Real, N>::StaticPolynomial(const std::array<Real, N + 1> &coefs) : _coefs(coefs) {}
+
+    template <typename Real, size_t N>
+    inline StaticPolynomial<Real, N>::StaticPolynomial(const Polynomial<Real> &p) : _coefs{}
     {
-        _degree = (std::max(degree, p.degree));
-        _coefs.resize(_degree + 1, Trait<Real>::zero());
         for (size_t i = 0; i <= p.degree; i++)
+        {
+            if (i > N && p[i] != Real(0.0))
+            {
+                printf("Error at: file %s line %d.\n", __FILE__, __LINE__);
+                exit(0);
+            }
+            else if (i <= N)
+            {
+                _coefs[i] = p[i];
+            }
+        }
+    }
+
+    template <typename Real, size_t N>
+    constexpr const StaticPolynomial<Real, (N > 0) ? N - 1 : 0> StaticPolynomial<Real, N>::differential() const
+    {
+        StaticPolynomial<Real, (N > 0) ? N - 1 : 0> res;
+        for (size_t i = 1; i <= N; i++)
+        {
+            res[i - 1] = i * _coefs[i];
+        }
+        return res;
+    }
+
+    template <typename Real, size_t N>
+    constexpr const StaticPolynomial<Real, N + 1> StaticPolynomial<Real, N>::integral(const Real &x) const
+    {
+        StaticPolynomial<Real, N + 1> res;
+        for (size_t i = 0; i <= N; i++)
+        {
+            res[i + 1] = _coefs[i] / (i + 1.0);
+        }
+        res[0] = -res(x);
+        return res;
+    }
+
+    template <typename Real, size_t N>
+    inline std::string StaticPolynomial<Real, N>::print(const Real &precision) const
+    {
+        return Polynomial<Real>(*this).print(precision);
+    }
+
+    template <typename Real, size_t N>
+    template <size_t M>
+    constexpr StaticPolynomial<Real, N> &StaticPolynomial<Real, N>::operator+=(const StaticPolynomial<Real, M> &p)
+    {
+        static_assert(M <= N, "Degree of the right operand exceeds the left.");
+        for (size_t i = 0; i <= M; i++)
         {
             _coefs[i] += p[i];
         }
         return (*this);
     }
 
-    template <typename Real>
-    inline Polynomial<Real> &Polynomial<Real>::operator+=(const Real &k)
+    template <typename Real, size_t N>
+    constexpr StaticPolynomial<Real, N> &StaticPolynomial<Real, N>::operator+=(const Real &k)
     {
         _coefs[0] += k;
         return (*this);
     }
 
-    template <typename Real>
-    inline Polynomial<Real> &Polynomial<Real>::operator-=(const Polynomial &p)
+    template <typename Real, size_t N>
+    template <size_t M>
+    constexpr StaticPolynomial<Real, N> &StaticPolynomial<Real, N>::operator-=(const StaticPolynomial<Real, M> &p)
     {
-        _degree = (std::max(degree, p.degree));
-        _coefs.resize(_degree + 1, Trait<Real>::zero());
-        for (size_t i = 0; i <= p.degree; i++)
+        static_assert(M <= N, "Degree of the right operand exceeds the left.");
+        for (size_t i = 0; i <= M; i++)
         {
             _coefs[i] -= p[i];
         }
         return (*this);
     }
 
-    template <typename Real>
-    inline Polynomial<Real> &Polynomial<Real>::operator-=(const Real &k)
+    template <typename Real, size_t N>
+    constexpr StaticPolynomial<Real, N> &StaticPolynomial<Real, N>::operator-=(const Real &k)
     {
         _coefs[0] -= k;
         return (*this);
     }
 
-    template <typename Real>
-    inline Polynomial<Real> &Polynomial<Real>::operator*=(const Polynomial &p)
+    template <typename Real, size_t N>
+    constexpr StaticPolynomial<Real, N> &StaticPolynomial<Real, N>::operator*=(const Real &k)
     {
-        Polynomial tmp(degree + p.degree);
-        for (size_t i = 0; i <= degree; i++)
+        for (size_t i = 0; i <= N; i++)
         {
-            for (size_t j = 0; j <= p.degree; j++)
-            {
-                tmp[i + j] += (_coefs[i] * p[j]);
-            }
+            _coefs[i] *= k;
         }
-        (*this) = tmp;
         return (*this);
     }
 
-    template <typename Real>
-    inline Polynomial<Real> &Polynomial<Real>::operator*=(const Real &k)
+    template <typename Real, size_t N>
+    constexpr StaticPolynomial<Real, N> &StaticPolynomial<Real, N>::operator/=(const Real &k)
     {
-        for (size_t i = 0; i <= degree; i++)
+        for (size_t i = 0; i <= N; i++)
         {
-            _coefs[i] *= k;
+            _coefs[i] /= k;
         }
         return (*this);
     }
 
+    template <typename Real, size_t N>
+    constexpr const Real StaticPolynomial<Real, N>::operator()(const Real &x) const
+    {
+        return horner(x, std::make_index_sequence<N>());
+    }
+
+    template <typename Real, size_t N>
+    constexpr const Real StaticPolynomial<Real, N>::operator[](const size_t &n) const
+    {
+        if (n > N)
+        {
+            return 0.0;
+        }
+        return _coefs[n];
+    }
+
+    template <typename Real, size_t N>
+    constexpr Real &StaticPolynomial<Real, N>::operator[](const size_t &n)
+    {
+        if (n > N)
+        {
+            printf("Error at: file %s line %d.\n", __FILE__, __LINE__);
+            exit(0);
+        }
+        return _coefs[n];
+    }
+
     template <typename Real>
-    inline Polynomial<Real> &Polynomial<Real>::operator/=(const Real &k)
+    inline BarycentricInterpolator<Real>::BarycentricInterpolator() : node(_node), value(_value), weight(_weight)
     {
-        for (size_t i = 0; i <= degree; i++)
+        _scale = 1.0;
+    }
+
+    template <typename Real>
+    inline BarycentricInterpolator<Real>::BarycentricInterpolator(const BarycentricInterpolator &b)
+        : _node(b.node), _value(b.value), _weight(b.weight), _scale(b._scale), node(_node), value(_value), weight(_weight) {}
+
+    template <typename Real>
+    inline BarycentricInterpolator<Real>::BarycentricInterpolator(const std::vector<Real> &x, const std::vector<Real> &y)
+        : _node(x), _value(y), node(_node), value(_value), weight(_weight)
+    {
+        const size_t n = x.size();
+        if (n != y.size())
         {
-            _coefs[i] /= k;
+            printf("Error at: file %s line %d.\n", __FILE__, __LINE__);
+            exit(0);
+        }
+        _scale = (n > 1) ? (*std::max_element(x.begin(), x.end()) - *std::min_element(x.begin(), x.end())) / 4 : 1.0;
+        _weight.resize(n);
+#pragma omp parallel for if (n >= 256)
+        for (size_t j = 0; j < n; j++)
+        {
+            Real w = 1.0;
+            for (size_t k = 0; k < n; k++)
+            {
+                if (k != j)
+                {
+                    w *= (x[j] - x[k]) / _scale;
+                }
+            }
+            _weight[j] = 1.0 / w;
+        }
+        if (std::find_if(_weight.begin(), _weight.end(), [](const Real &w)
+                         { return !std::isfinite(w); }) != _weight.end())
+        {
+            printf("Error at: file %s line %d.\n", __FILE__, __LINE__);
+            exit(0);
         }
-        return (*this);
     }
 
     template <typename Real>
-    inline Polynomial<Real> &Polynomial<Real>::operator/=(const Polynomial<Real> &p)
+    inline const BarycentricInterpolator<Real> BarycentricInterpolator<Real>::chebyshev(const std::function<const Real(const Real &)> &f, const size_t &n, const Real &min, const Real &max)
     {
-        Polynomial res = Trait<Polynomial>::identity();
-        while (_degree >= p.degree)
+        BarycentricInterpolator res;
+        if (n == 0)
         {
-            size_t i = _degree - p.degree;
-            Polynomial x = (_coefs[_degree] / p[p.degree]) * Trait<Polynomial>::basis(i);
-            res += x;
-            (*this) -= (x * p);
-            _coefs.resize(_degree);
-            _degree--;
+            return res;
         }
-        (*this) = res;
-        return (*this);
+        const size_t m = n - 1;
+        res._scale = (n > 1) ? (max - min) / 4 : 1.0;
+        res._node.resize(n);
+        res._value.resize(n);
+        res._weight.resize(n);
+#pragma omp parallel for if (n >= 256)
+        for (size_t j = 0; j < n; j++)
+        {
+            res._node[j] = (m > 0) ? (min + max) / 2 + (max - min) / 2 * std::cos(std::numbers::pi_v<Real> * j / m) : (min + max) / 2;
+            res._value[j] = f(res._node[j]);
+            res._weight[j] = (m > 0) ? ((j % 2 == 0) ? 1.0 : -1.0) / ((j == 0 || j == m) ? 4.0 * m : 2.0 * m) : 1.0;
+        }
+        return res;
     }
 
     template <typename Real>
-    inline Polynomial<Real> &Polynomial<Real>::operator%=(const Polynomial<Real> &p)
+    inline void BarycentricInterpolator<Real>::add(const Real &x, const Real &y)
     {
-        Polynomial res = Trait<Polynomial>::identity();
-        while (_degree >= p.degree)
+        const size_t n = _node.size();
+        Real w = 1.0;
+        for (size_t j = 0; j < n; j++)
         {
-            size_t i = _degree - p.degree;
-            Polynomial x = (_coefs[_degree] / p[p.degree]) * Trait<Polynomial>::basis(i);
-            res += x;
-            (*this) -= (x * p);
-            _coefs.resize(_degree);
-            _degree--;
+            const Real d = (x - _node[j]) / _scale;
+            if (d == Real(0.0))
+            {
+                printf("Error at: file %s line %d.\n", __FILE__, __LINE__);
+                exit(0);
+            }
+            _weight[j] /= -d;
+            w *= d;
         }
-        return (*this);
+        _node.push_back(x);
+        _value.push_back(y);
+        _weight.push_back(1.0 / w);
     }
 
     template <typename Real>
-    inline const Real Polynomial<Real>::operator()(const Real &x) const
+    inline void BarycentricInterpolator<Real>::evaluate(const Real *first, const Real *last, Real *res) const
     {
-        Real res = 0.0;
-        Real k = 1.0;
-        for (size_t i = 0; i <= degree; i++, k *= x)
+        const size_t n = last - first;
+#pragma omp parallel for if (n * _node.size() >= (1 << 16))
+        for (size_t i = 0; i < n; i++)
         {
-            res += (k * this->_coefs[i]);
+            res[i] = operator()(first[i]);
         }
+    }
+
+    template <typename Real>
+    inline const std::vector<Real> BarycentricInterpolator<Real>::evaluate(const std::vector<Real> &x) const
+    {
+        std::vector<Real> res(x.size());
+        evaluate(x.data(), x.data() + x.size(), res.data());
         return res;
     }
 
     template <typename Real>
-    inline const Real Polynomial<Real>::operator[](const size_t &n) const
+    inline const Vector<Real> BarycentricInterpolator<Real>::evaluate(const Vector<Real> &x) const
     {
-        if (n > degree)
+        Vector<Real> res(x.size());
+        evaluate(x.data(), x.data() + x.size(), res.data());
+        return res;
+    }
+
+    template <typename Real>
+    inline const Real BarycentricInterpolator<Real>::operator()(const Real &x) const
+    {
+        if (_node.empty())
         {
             return 0.0;
         }
-        return this->_coefs[n];
+        Real num = 0.0, den = 0.0;
+        for (size_t j = 0; j < _node.size(); j++)
+        {
+            const Real d = x - _node[j];
+            if (d == Real(0.0))
+            {
+                return _value[j];
+            }
+            const Real c = _weight[j] / d;
+            num += c * _value[j];
+            den += c;
+        }
+        return num / den;
     }
 
     template <typename Real>
-    inline Real &Polynomial<Real>::operator[](const size_t &n)
+    inline BarycentricInterpolator<Real> &BarycentricInterpolator<Real>::operator=(const BarycentricInterpolator<Real> &b)
     {
-        if (n > degree)
+        if (this != &b)
+        {
+            this->_node = b.node;
+            this->_value = b.value;
+            this->_weight = b.weight;
+            this->_scale = b._scale;
+        }
+        return (*this);
+    }
+
+    template <typename Real>
+    inline NewtonInterpolator<Real>::NewtonInterpolator(const size_t &window) : node(_node), coefs(_coefs), window(_window)
+    {
+        _window = window;
+    }
+
+    template <typename Real>
+    inline NewtonInterpolator<Real>::NewtonInterpolator(const NewtonInterpolator &n)
+        : _node(n.node), _coefs(n.coefs), _window(n.window), node(_node), coefs(_coefs), window(_window) {}
+
+    template <typename Real>
+    inline NewtonInterpolator<Real>::NewtonInterpolator(const std::vector<Real> &x, const std::vector<Real> &y, const size_t &window)
+        : NewtonInterpolator(window)
+    {
+        if (x.size() != y.size())
         {
             printf("Error at: file %s line %d.\n", __FILE__, __LINE__);
             exit(0);
         }
-        return this->_coefs[n];
+        for (size_t i = 0; i < x.size(); i++)
+        {
+            add(x[i], y[i]);
+        }
     }
 
     template <typename Real>
-    inline const Polynomial<Real> Trait<Polynomial<Real>>::zero()
+    inline void NewtonInterpolator<Real>::add(const Real &x, const Real &y)
     {
-        return Polynomial<Real>(Trait<Real>::zero());
+        Real d = y;
+        for (size_t k = 0; k < _node.size(); k++)
+        {
+            if (x == _node[k])
+            {
+                printf("Error at: file %s line %d.\n", __FILE__, __LINE__);
+                exit(0);
+            }
+            const Real next = (d - _coefs[k]) / (x - _node[k]);
+            _coefs[k] = d;
+            d = next;
+        }
+        _coefs.push_back(d);
+        _node.push_front(x);
+        if (_window > 0 && _node.size() > _window)
+        {
+            _node.pop_back();
+            _coefs.pop_back();
+        }
     }
 
     template <typename Real>
-    inline const Polynomial<Real> Trait<Polynomial<Real>>::identity()
+    inline const Polynomial<Real> NewtonInterpolator<Real>::polynomial() const
     {
-        return Polynomial<Real>(std::vector<Real>({Trait<Real>::identity()}));
+        if (_coefs.empty())
+        {
+            return Polynomial<Real>(0);
+        }
+        Polynomial<Real> res(std::vector<Real>({_coefs.back()}));
+        for (size_t k = _coefs.size() - 1; k > 0; k--)
+        {
+            res *= Polynomial<Real>({-_node[k - 1], 1.0});
+            res += _coefs[k - 1];
+        }
+        return res;
     }
 
     template <typename Real>
-    inline const Polynomial<Real> Trait<Polynomial<Real>>::basis(const size_t &n)
+    inline void NewtonInterpolator<Real>::evaluate(const Real *first, const Real *last, Real *res) const
     {
-        Polynomial<Real> p(n);
-        p[n] = Trait<Real>::identity();
-        return p;
+        const size_t n = last - first;
+#pragma omp parallel for if (n * _node.size() >= (1 << 16))
+        for (size_t i = 0; i < n; i++)
+        {
+            res[i] = operator()(first[i]);
+        }
+    }
+
+    template <typename Real>
+    inline const std::vector<Real> NewtonInterpolator<Real>::evaluate(const std::vector<Real> &x) const
+    {
+        std::vector<Real> res(x.size());
+        evaluate(x.data(), x.data() + x.size(), res.data());
+        return res;
+    }
+
+    template <typename Real>
+    inline const Vector<Real> NewtonInterpolator<Real>::evaluate(const Vector<Real> &x) const
+    {
+        Vector<Real> res(x.size());
+        evaluate(x.data(), x.data() + x.size(), res.data());
+        return res;
+    }
+
+    template <typename Real>
+    inline const Real NewtonInterpolator<Real>::operator()(const Real &x) const
+    {
+        if (_coefs.empty())
+        {
+            return 0.0;
+        }
+        Real res = _coefs.back();
+        for (size_t k = _coefs.size() - 1; k > 0; k--)
+        {
+            res = res * (x - _node[k - 1]) + _coefs[k - 1];
+        }
+        return res;
+    }
+
+    template <typename Real>
+    inline NewtonInterpolator<Real> &NewtonInterpolator<Real>::operator=(const NewtonInterpolator<Real> &n)
+    {
+        if (this != &n)
+        {
+            this->_node = n.node;
+            this->_coefs = n.coefs;
+            this->_window = n.window;
+        }
+        return (*this);
     }
 
     template <typename Real>
@@ -0,0 +1,87 @@
+#ifndef MTK_QUASIRANDOM_H
+#define MTK_QUASIRANDOM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Trait.h"
+
+static_assert(__cplusplus >= 201700, "C++17 or higher is required.");
+
+namespace mtk
+{
+    class Sobol;
+    class Halton;
+
+    class Sobol
+    {
+    public:
+        static constexpr size_t max_dimension = 1000;
+
+    private:
+        static constexpr size_t _bit = 32;
+        static const uint16_t _polynomial[max_dimension - 1];
+        static const uint16_t _initial[];
+
+    private:
+        size_t _dimension;
+        uint64_t _index;
+        std::vector<uint32_t> _direction;
+        std::vector<uint32_t> _x;
+
+    public:
+        const size_t &dimension;
+        const uint64_t &index;
+
+    private:
+        void state(const uint64_t &index, uint32_t *x) const;
+
+    public:
+        Sobol(const size_t &dimension);
+        Sobol(const Sobol &sobol);
+
+        void skip(const uint64_t &n);
+
+        template <typename Real>
+        const Vector<Real> next();
+        template <typename Real>
+        const Matrix<Real> next(const size_t &n);
+
+        Sobol &operator=(const Sobol &sobol);
+    };
+
+    class Halton
+    {
+    private:
+        size_t _dimension;
+        uint64_t _index;
+        std::vector<size_t> _base;
+        std::vector<std::vector<size_t>> _permutation;
+
+    public:
+        const size_t &dimension;
+        const uint64_t &index;
+
+    private:
+        template <typename Real>
+        void point(const uint64_t &index, Real *x) const;
+
+    public:
+        Halton(const size_t &dimension, const bool &scramble = true, const size_t &seed = 0);
+        Halton(const Halton &halton);
+
+        void skip(const uint64_t &n);
+
+        template <typename Real>
+        const Vector<Real> next();
+        template <typename Real>
+        const Matrix<Real> next(const size_t &n);
+
+        Halton &operator=(const Halton &halton);
+    };
+};
+
+#include "QuasiRandom.hpp"
+
+#endif
@@ -1,29 +1,218 @@
 #ifndef MTK_RANDOM_H
 #define MTK_RANDOM_H
 
+#include <array>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <iterator>
 #include <random>
 
+#include "Array.h"
+#include "Trait.h"
+
 static_assert(__cplusplus >= 201700, "C++17 or higher is required.");
 
 namespace mtk
 {
-    class Random;
+    class SplitMix64;
+    class Xoshiro256StarStar;
+#if defined(__SIZEOF_INT128__)
+    class PCG64;
+#endif
+    class Philox4x32;
+    class Threefry2x64;
+    template <typename Engine>
+    class BasicRandom;
+    template <typename Engine, typename Distribution>
+    class RandomVariable;
+    template <typename OutputType, typename Real>
+    class DiscreteProbability;
+    template <typename Real>
+    class ContinuousProbability;
+    template <typename Real>
+    class ContinuousDistribution;
+    class Ziggurat;
+    template <typename Real>
+    class NormalZiggurat;
+    template <typename Real>
+    class ExponentialZiggurat;
+    template <typename Real>
+    class MultivariateNormal;
+    template <typename Real>
+    class AdaptiveRejection;
+
+    using Random = BasicRandom<std::default_random_engine>;
+
+    class SplitMix64
+    {
+    public:
+        using result_type = uint64_t;
+
+    private:
+        uint64_t _state;
+
+    public:
+        SplitMix64(const size_t &seed = 0);
+        SplitMix64(const SplitMix64 &engine);
+
+        void seed(const size_t &seed);
+        void advance(const uint64_t &n);
+
+        static constexpr result_type min();
+        static constexpr result_type max();
+
+        result_type operator()();
+
+        SplitMix64 &operator=(const SplitMix64 &engine);
+    };
+
+    class Xoshiro256StarStar
+    {
+    public:
+        using result_type = uint64_t;
+
+    private:
+        uint64_t _state[4];
+
+    private:
+        void jump(const uint64_t (&table)[4]);
+
+    public:
+        Xoshiro256StarStar(const size_t &seed = 0);
+        Xoshiro256StarStar(const Xoshiro256StarStar &engine);
+
+        void seed(const size_t &seed);
+        void jump();
+        void longJump();
+
+        static constexpr result_type min();
+        static constexpr result_type max();
+
+        result_type operator()();
+
+        Xoshiro256StarStar &operator=(const Xoshiro256StarStar &engine);
+    };
+
+#if defined(__SIZEOF_INT128__)
+    class PCG64
+    {
+    public:
+        using result_type = uint64_t;
+
+    private:
+        static constexpr __uint128_t _multiplier = (__uint128_t(0x2360ED051FC65DA4ULL) << 64) | 0x4385DF649FCCF645ULL;
+
+    private:
+        __uint128_t _state;
+        __uint128_t _increment;
+
+    private:
+        void advance(const uint64_t &n, __uint128_t multiplier, __uint128_t increment);
+
+    public:
+        PCG64(const size_t &seed = 0);
+        PCG64(const PCG64 &engine);
+
+        void seed(const size_t &seed);
+        void advance(const uint64_t &n);
+        void jump();
+
+        static constexpr result_type min();
+        static constexpr result_type max();
+
+        result_type operator()();
+
+        PCG64 &operator=(const PCG64 &engine);
+    };
+#endif
+
+    class Philox4x32
+    {
+    public:
+        using result_type = uint64_t;
+
+    private:
+        uint32_t _key[2];
+        uint64_t _stream;
+        uint64_t _position;
+        uint64_t _block;
+        bool _ready;
+        uint64_t _output[2];
+
+    private:
+        void generate(const uint64_t &block);
 
-    class Random
+    public:
+        Philox4x32(const size_t &seed = 0);
+        Philox4x32(const Philox4x32 &engine);
+
+        void seed(const size_t &seed);
+        const Philox4x32 stream(const uint64_t &id) const;
+        void skip(const uint64_t &n);
+
+        static constexpr result_type min();
+        static constexpr result_type max();
+
+        result_type operator()();
+
+        Philox4x32 &operator=(const Philox4x32 &engine);
+    };
+
+    class Threefry2x64
+    {
+    public:
+        using result_type = uint64_t;
+
+    private:
+        uint64_t _key[2];
+        uint64_t _stream;
+        uint64_t _position;
+        uint64_t _block;
+        bool _ready;
+        uint64_t _output[2];
+
+    private:
+        void generate(const uint64_t &block);
+
+    public:
+        Threefry2x64(const size_t &seed = 0);
+        Threefry2x64(const Threefry2x64 &engine);
+
+        void seed(const size_t &seed);
+        const Threefry2x64 stream(const uint64_t &id) const;
+        void skip(const uint64_t &n);
+
+        static constexpr result_type min();
+        static constexpr result_type max();
+
+        result_type operator()();
+
+        Threefry2x64 &operator=(const Threefry2x64 &engine);
+    };
+
+    template <typename Engine>
+    class BasicRandom
     {
     private:
-        std::default_random_engine _random_engine;
+        Engine _random_engine;
 
     public:
-        const std::default_random_engine &random_engine;
+        const Engine &random_engine;
+
+    private:
+        template <typename Real>
+        void canonical(Real *data, const size_t &n);
+        const std::vector<Engine> split(const size_t &n);
+        template <typename Iterator>
+        static void merge(Iterator first, Iterator middle, Iterator last, Engine &engine);
 
     public:
-        Random();
-        Random(const size_t &seed);
-        Random(const Random &random);
+        BasicRandom();
+        BasicRandom(const size_t &seed);
+        BasicRandom(const Engine &engine);
+        BasicRandom(const BasicRandom &random);
 
         void seed(const size_t &seed);
 
@@ -56,7 +245,343 @@ namespace mtk
                                           const Real &delta = std::numeric_limits<float>::epsilon(),
                                           const size_t &max_loop_num = std::numeric_limits<short>::max());
 
-        Random &operator=(const Random &random);
+        template <typename Real>
+        void uniform(Real *first, Real *last, const Real &min, const Real &max);
+        template <typename Real>
+        void uniform(Vector<Real> &v, const Real &min, const Real &max);
+        template <typename Real>
+        void uniform(Matrix<Real> &m, const Real &min, const Real &max);
+        template <typename Real>
+        void uniform(Array<Real> &a, const Real &min, const Real &max);
+        template <typename Real>
+        void normal(Real *first, Real *last, const Real &expectation, const Real &variance);
+        template <typename Real>
+        void normal(Vector<Real> &v, const Real &expectation, const Real &variance);
+        template <typename Real>
+        void normal(Matrix<Real> &m, const Real &expectation, const Real &variance);
+        template <typename Real>
+        void normal(Array<Real> &a, const Real &expectation, const Real &variance);
+        template <typename Real>
+        void exponential(Real *first, Real *last, const Real &lambda);
+        template <typename Real>
+        void exponential(Vector<Real> &v, const Real &lambda);
+        template <typename Real>
+        void exponential(Matrix<Real> &m, const Real &lambda);
+        template <typename Real>
+        void exponential(Array<Real> &a, const Real &lambda);
+
+        template <typename Iterator, typename Distribution>
+        void fill(Iterator first, Iterator last, Distribution &distribution);
+        template <typename Real, typename Distribution>
+        void fill(Vector<Real> &v, Distribution &distribution);
+        template <typename Real, typename Distribution>
+        void fill(Matrix<Real> &m, Distribution &distribution);
+        template <typename Real, typename Distribution>
+        void fill(Array<Real> &a, Distribution &distribution);
+        template <typename Real>
+        void fill(Matrix<Real> &m, MultivariateNormal<Real> &distribution);
+
+        template <typename Distribution>
+        const typename Distribution::result_type operator()(Distribution &distribution);
+        template <typename Distribution>
+        const std::vector<typename Distribution::result_type> operator()(Distribution &distribution, const size_t &n);
+
+        template <typename Distribution>
+        RandomVariable<Engine, Distribution> variable(const Distribution &distribution);
+
+        template <typename Iterator>
+        void shuffle(Iterator first, Iterator last);
+        template <typename Real>
+        void shuffle(Vector<Real> &v);
+        template <typename Type>
+        void shuffle(Array<Type> &a);
+        const std::vector<size_t> permutation(const size_t &n);
+        const std::vector<size_t> sample(const size_t &n, const size_t &k);
+        template <typename Iterator>
+        const std::vector<typename std::iterator_traits<Iterator>::value_type> reservoir(Iterator first, Iterator last, const size_t &k);
+        const Matrix<size_t> bootstrap(const size_t &n, const size_t &batch);
+        template <typename Real>
+        const Matrix<Real> bootstrap(const Vector<Real> &v, const size_t &batch);
+        template <typename Type>
+        const Array<Type> bootstrap(const Array<Type> &a, const size_t &batch);
+
+        BasicRandom &operator=(const BasicRandom &random);
+    };
+
+    template <typename Engine, typename Distribution>
+    class RandomVariable
+    {
+    public:
+        using result_type = typename Distribution::result_type;
+
+    private:
+        BasicRandom<Engine> *_random;
+        Distribution _distribution;
+
+    public:
+        const Distribution &distribution;
+
+    public:
+        RandomVariable(BasicRandom<Engine> &random, const Distribution &distribution);
+        RandomVariable(const RandomVariable &variable);
+
+        const std::vector<result_type> sample(const size_t &n);
+
+        const result_type operator()();
+
+        RandomVariable &operator=(const RandomVariable &variable);
+    };
+
+    template <typename OutputType, typename Real>
+    class DiscreteProbability
+    {
+    public:
+        using result_type = OutputType;
+
+    private:
+        std::vector<std::pair<OutputType, Real>> _p;
+        std::vector<Real> _prob;
+        std::vector<size_t> _alias;
+        std::vector<Real> _tree;
+        size_t _pending;
+        size_t _draws;
+
+    public:
+        const std::vector<std::pair<OutputType, Real>> &p;
+
+    private:
+        void build();
+        const size_t search(Real u) const;
+
+    public:
+        DiscreteProbability(const std::vector<std::pair<OutputType, Real>> &p);
+        DiscreteProbability(const DiscreteProbability &d);
+
+        void setWeight(const size_t &index, const Real &weight);
+
+        template <typename Engine>
+        const OutputType operator()(Engine &engine);
+
+        DiscreteProbability &operator=(const DiscreteProbability &d);
+    };
+
+    template <typename Real>
+    class ContinuousProbability
+    {
+    public:
+        using result_type = Real;
+
+    private:
+        Real _min;
+        Real _max;
+        Real _step;
+        std::vector<Real> _pdf;
+        std::vector<Real> _cdf;
+        std::vector<size_t> _guide;
+
+    public:
+        const Real &min;
+        const Real &max;
+
+    public:
+        ContinuousProbability(const Real &min, const Real &max,
+                              const std::function<const Real(const Real &)> &p,
+                              const size_t &n = std::numeric_limits<short>::max());
+        ContinuousProbability(const ContinuousProbability &d);
+
+        template <typename Engine>
+        const Real operator()(Engine &engine) const;
+
+        ContinuousProbability &operator=(const ContinuousProbability &d);
+    };
+
+    template <typename Real>
+    class ContinuousDistribution
+    {
+    public:
+        using result_type = Real;
+
+    private:
+        static constexpr size_t _degree = 10;
+        static constexpr size_t _max_depth = 48;
+
+    private:
+        Real _min;
+        Real _max;
+        Real _epsilon;
+        std::function<const Real(const Real &)> _f;
+        std::vector<Real> _knot;
+        std::vector<std::vector<Real>> _coefs;
+
+    public:
+        const Real &min;
+        const Real &max;
+
+    private:
+        const Real inverse(const Real &y) const;
+        const Real clenshaw(const std::vector<Real> &c, const Real &t) const;
+        void build(const Real &a, const Real &b, const size_t &depth);
+
+    public:
+        ContinuousDistribution(const Real &min, const Real &max,
+                               const std::function<const Real(const Real &)> &f,
+                               const Real &epsilon = std::numeric_limits<float>::epsilon());
+        ContinuousDistribution(const ContinuousDistribution &d);
+
+        const Real quantile(const Real &y) const;
+
+        template <typename Engine>
+        const Real operator()(Engine &engine) const;
+
+        ContinuousDistribution &operator=(const ContinuousDistribution &d);
+    };
+
+    class Ziggurat
+    {
+    public:
+        static constexpr size_t layer = 256;
+
+    public:
+        Ziggurat() = delete;
+
+        static constexpr double exp(const double &x);
+        static constexpr double log(const double &x);
+        static constexpr double sqrt(const double &x);
+
+        static constexpr std::array<double, layer + 1> normal();
+        static constexpr std::array<double, layer + 1> exponential();
+        static constexpr std::array<double, layer> ratio(const std::array<double, layer + 1> &x);
+    };
+
+    template <typename Real>
+    class NormalZiggurat
+    {
+    public:
+        using result_type = Real;
+
+    private:
+        static constexpr std::array<double, Ziggurat::layer + 1> _x = Ziggurat::normal();
+        static constexpr std::array<double, Ziggurat::layer> _ratio = Ziggurat::ratio(_x);
+
+    private:
+        Real _expectation;
+        Real _variance;
+
+    public:
+        const Real &expectation;
+        const Real &variance;
+
+    public:
+        NormalZiggurat(const Real &expectation = 0.0, const Real &variance = 1.0);
+        NormalZiggurat(const NormalZiggurat &d);
+
+        template <typename Engine>
+        const Real operator()(Engine &engine) const;
+
+        NormalZiggurat &operator=(const NormalZiggurat &d);
+    };
+
+    template <typename Real>
+    class ExponentialZiggurat
+    {
+    public:
+        using result_type = Real;
+
+    private:
+        static constexpr std::array<double, Ziggurat::layer + 1> _x = Ziggurat::exponential();
+        static constexpr std::array<double, Ziggurat::layer> _ratio = Ziggurat::ratio(_x);
+
+    private:
+        Real _lambda;
+
+    public:
+        const Real &lambda;
+
+    public:
+        ExponentialZiggurat(const Real &lambda = 1.0);
+        ExponentialZiggurat(const ExponentialZiggurat &d);
+
+        template <typename Engine>
+        const Real operator()(Engine &engine) const;
+
+        ExponentialZiggurat &operator=(const ExponentialZiggurat &d);
+    };
+
+    template <typename Real>
+    class MultivariateNormal
+    {
+    public:
+        using result_type = Vector<Real>;
+
+    private:
+        Vector<Real> _expectation;
+        Matrix<Real> _factor;
+        Vector<Real> _diagonal;
+
+    public:
+        const Vector<Real> &expectation;
+        const Matrix<Real> &factor;
+        const Vector<Real> &diagonal;
+
+    public:
+        MultivariateNormal(const Vector<Real> &expectation, const Matrix<Real> &covariance);
+        MultivariateNormal(const Vector<Real> &expectation, const Matrix<Real> &factor, const Vector<Real> &diagonal);
+        MultivariateNormal(const MultivariateNormal &d);
+
+        const Matrix<Real> covariance() const;
+
+        template <typename Engine>
+        const Vector<Real> operator()(Engine &engine) const;
+        template <typename Engine>
+        const Matrix<Real> operator()(Engine &engine, const size_t &n) const;
+
+        MultivariateNormal &operator=(const MultivariateNormal &d);
+    };
+
+    template <typename Real>
+    class AdaptiveRejection
+    {
+    public:
+        using result_type = Real;
+
+    private:
+        Real _min;
+        Real _max;
+        size_t _max_point;
+        size_t _evaluation;
+        std::function<const Real(const Real &)> _f;
+        std::vector<Real> _x;
+        std::vector<Real> _h;
+        std::vector<Real> _anchor;
+        std::vector<Real> _end;
+        std::vector<Real> _value;
+        std::vector<Real> _slope;
+        std::vector<Real> _area;
+
+    public:
+        const Real &min;
+        const Real &max;
+        const size_t &evaluation;
+        const std::vector<Real> &point;
+
+    private:
+        const Real chord(const size_t &i, const Real &x) const;
+        void segment(const Real &anchor, const Real &end, const size_t &i);
+        void build();
+        void insert(const Real &x, const Real &h);
+        const Real squeeze(const Real &x) const;
+
+    public:
+        AdaptiveRejection(const std::function<const Real(const Real &)> &log_density, const std::vector<Real> &point,
+                          const Real &min = -std::numeric_limits<Real>::infinity(),
+                          const Real &max = std::numeric_limits<Real>::infinity(),
+                          const size_t &max_point = 64);
+        AdaptiveRejection(const AdaptiveRejection &d);
+
+        template <typename Engine>
+        const Real operator()(Engine &engine);
+
+        AdaptiveRejection &operator=(const AdaptiveRejection &d);
     };
 };
 
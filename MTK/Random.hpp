@@ -1,31 +1,479 @@
 #ifndef MTK_RANDOM_HPP
 #define MTK_RANDOM_HPP
 
+#include <algorithm>
+#include <cmath>
+#include <unordered_set>
 #include <vector>
 
 #include "Random.h"
 
 namespace mtk
 {
-    inline Random::Random() : random_engine(_random_engine)
+    inline SplitMix64::SplitMix64(const size_t &seed)
+    {
+        this->seed(seed);
+    }
+
+    inline SplitMix64::SplitMix64(const SplitMix64 &engine) : _state(engine._state) {}
+
+    inline void SplitMix64::seed(const size_t &seed)
+    {
+        _state = seed;
+    }
+
+    inline void SplitMix64::advance(const uint64_t &n)
+    {
+        _state += n * 0x9E3779B97F4A7C15ULL;
+    }
+
+    inline constexpr SplitMix64::result_type SplitMix64::min()
+    {
+        return std::numeric_limits<result_type>::min();
+    }
+
+    inline constexpr SplitMix64::result_type SplitMix64::max()
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    inline SplitMix64::result_type SplitMix64::operator()()
+    {
+        uint64_t z = (_state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    inline SplitMix64 &SplitMix64::operator=(const SplitMix64 &engine)
+    {
+        this->_state = engine._state;
+        return (*this);
+    }
+
+    inline Xoshiro256StarStar::Xoshiro256StarStar(const size_t &seed)
+    {
+        this->seed(seed);
+    }
+
+    inline Xoshiro256StarStar::Xoshiro256StarStar(const Xoshiro256StarStar &engine)
+    {
+        (*this) = engine;
+    }
+
+    inline void Xoshiro256StarStar::seed(const size_t &seed)
+    {
+        SplitMix64 engine(seed);
+        for (size_t i = 0; i < 4; i++)
+        {
+            _state[i] = engine();
+        }
+    }
+
+    inline void Xoshiro256StarStar::jump(const uint64_t (&table)[4])
+    {
+        uint64_t s[4] = {0, 0, 0, 0};
+        for (size_t i = 0; i < 4; i++)
+        {
+            for (size_t b = 0; b < 64; b++)
+            {
+                if (table[i] & (uint64_t(1) << b))
+                {
+                    for (size_t j = 0; j < 4; j++)
+                    {
+                        s[j] ^= _state[j];
+                    }
+                }
+                (*this)();
+            }
+        }
+        for (size_t j = 0; j < 4; j++)
+        {
+            _state[j] = s[j];
+        }
+    }
+
+    inline void Xoshiro256StarStar::jump()
+    {
+        static constexpr uint64_t table[4] = {0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL,
+                                              0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL};
+        jump(table);
+    }
+
+    inline void Xoshiro256StarStar::longJump()
+    {
+        static constexpr uint64_t table[4] = {0x76E15D3EFEFDCBBFULL, 0xC5004E441C522FB3ULL,
+                                              0x77710069854EE241ULL, 0x39109BB02ACBE635ULL};
+        jump(table);
+    }
+
+    inline constexpr Xoshiro256StarStar::result_type Xoshiro256StarStar::min()
+    {
+        return std::numeric_limits<result_type>::min();
+    }
+
+    inline constexpr Xoshiro256StarStar::result_type Xoshiro256StarStar::max()
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    inline Xoshiro256StarStar::result_type Xoshiro256StarStar::operator()()
+    {
+        const uint64_t x = _state[1] * 5;
+        const uint64_t res = ((x << 7) | (x >> 57)) * 9;
+        const uint64_t t = _state[1] << 17;
+        _state[2] ^= _state[0];
+        _state[3] ^= _state[1];
+        _state[1] ^= _state[2];
+        _state[0] ^= _state[3];
+        _state[2] ^= t;
+        _state[3] = (_state[3] << 45) | (_state[3] >> 19);
+        return res;
+    }
+
+    inline Xoshiro256StarStar &Xoshiro256StarStar::operator=(const Xoshiro256StarStar &engine)
+    {
+        if (this != &engine)
+        {
+            for (size_t i = 0; i < 4; i++)
+            {
+                this->_state[i] = engine._state[i];
+            }
+        }
+        return (*this);
+    }
+
+#if defined(__SIZEOF_INT128__)
+    inline PCG64::PCG64(const size_t &seed)
+    {
+        this->seed(seed);
+    }
+
+    inline PCG64::PCG64(const PCG64 &engine) : _state(engine._state), _increment(engine._increment) {}
+
+    inline void PCG64::seed(const size_t &seed)
+    {
+        SplitMix64 engine(seed);
+        const __uint128_t state = (__uint128_t(engine()) << 64) | engine();
+        const __uint128_t sequence = (__uint128_t(engine()) << 64) | engine();
+        _state = 0;
+        _increment = (sequence << 1) | 1;
+        (*this)();
+        _state += state;
+        (*this)();
+    }
+
+    inline void PCG64::advance(const uint64_t &n, __uint128_t multiplier, __uint128_t increment)
+    {
+        __uint128_t acc_multiplier = 1;
+        __uint128_t acc_increment = 0;
+        for (uint64_t k = n; k > 0; k >>= 1)
+        {
+            if (k & 1)
+            {
+                acc_multiplier *= multiplier;
+                acc_increment = acc_increment * multiplier + increment;
+            }
+            increment = (multiplier + 1) * increment;
+            multiplier *= multiplier;
+        }
+        _state = acc_multiplier * _state + acc_increment;
+    }
+
+    inline void PCG64::advance(const uint64_t &n)
+    {
+        advance(n, _multiplier, _increment);
+    }
+
+    inline void PCG64::jump()
+    {
+        __uint128_t multiplier = _multiplier;
+        __uint128_t increment = _increment;
+        for (size_t i = 0; i < 64; i++)
+        {
+            increment = (multiplier + 1) * increment;
+            multiplier *= multiplier;
+        }
+        advance(1, multiplier, increment);
+    }
+
+    inline constexpr PCG64::result_type PCG64::min()
+    {
+        return std::numeric_limits<result_type>::min();
+    }
+
+    inline constexpr PCG64::result_type PCG64::max()
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    inline PCG64::result_type PCG64::operator()()
+    {
+        _state = _state * _multiplier + _increment;
+        const uint64_t x = uint64_t(_state >> 64) ^ uint64_t(_state);
+        const unsigned int r = (unsigned int)(_state >> 122);
+        return (x >> r) | (x << ((64 - r) & 63));
+    }
+
+    inline PCG64 &PCG64::operator=(const PCG64 &engine)
+    {
+        this->_state = engine._state;
+        this->_increment = engine._increment;
+        return (*this);
+    }
+#endif
+
+    inline Philox4x32::Philox4x32(const size_t &seed)
+    {
+        this->seed(seed);
+    }
+
+    inline Philox4x32::Philox4x32(const Philox4x32 &engine)
+    {
+        (*this) = engine;
+    }
+
+    inline void Philox4x32::generate(const uint64_t &block)
+    {
+        uint32_t c[4] = {uint32_t(block), uint32_t(block >> 32), uint32_t(_stream), uint32_t(_stream >> 32)};
+        uint32_t k[2] = {_key[0], _key[1]};
+        for (size_t r = 0; r < 10; r++)
+        {
+            const uint64_t p0 = uint64_t(0xD2511F53U) * c[0];
+            const uint64_t p1 = uint64_t(0xCD9E8D57U) * c[2];
+            const uint32_t x[4] = {uint32_t(p1 >> 32) ^ c[1] ^ k[0], uint32_t(p1),
+                                   uint32_t(p0 >> 32) ^ c[3] ^ k[1], uint32_t(p0)};
+            for (size_t i = 0; i < 4; i++)
+            {
+                c[i] = x[i];
+            }
+            k[0] += 0x9E3779B9U;
+            k[1] += 0xBB67AE85U;
+        }
+        _output[0] = uint64_t(c[0]) | (uint64_t(c[1]) << 32);
+        _output[1] = uint64_t(c[2]) | (uint64_t(c[3]) << 32);
+        _block = block;
+        _ready = true;
+    }
+
+    inline void Philox4x32::seed(const size_t &seed)
+    {
+        _key[0] = uint32_t(seed);
+        _key[1] = uint32_t(uint64_t(seed) >> 32);
+        _stream = 0;
+        _position = 0;
+        _block = 0;
+        _output[0] = 0;
+        _output[1] = 0;
+        _ready = false;
+    }
+
+    inline const Philox4x32 Philox4x32::stream(const uint64_t &id) const
+    {
+        Philox4x32 engine(*this);
+        engine._stream = id;
+        engine._position = 0;
+        engine._ready = false;
+        return engine;
+    }
+
+    inline void Philox4x32::skip(const uint64_t &n)
+    {
+        _position += n;
+    }
+
+    inline constexpr Philox4x32::result_type Philox4x32::min()
+    {
+        return std::numeric_limits<result_type>::min();
+    }
+
+    inline constexpr Philox4x32::result_type Philox4x32::max()
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    inline Philox4x32::result_type Philox4x32::operator()()
+    {
+        const uint64_t block = _position >> 1;
+        if (!_ready || block != _block)
+        {
+            generate(block);
+        }
+        return _output[(_position++) & 1];
+    }
+
+    inline Philox4x32 &Philox4x32::operator=(const Philox4x32 &engine)
+    {
+        if (this != &engine)
+        {
+            this->_key[0] = engine._key[0];
+            this->_key[1] = engine._key[1];
+            this->_stream = engine._stream;
+            this->_position = engine._position;
+            this->_block = engine._block;
+            this->_ready = engine._ready;
+            this->_output[0] = engine._output[0];
+            this->_output[1] = engine._output[1];
+        }
+        return (*this);
+    }
+
+    inline Threefry2x64::Threefry2x64(const size_t &seed)
+    {
+        this->seed(seed);
+    }
+
+    inline Threefry2x64::Threefry2x64(const Threefry2x64 &engine)
+    {
+        (*this) = engine;
+    }
+
+    inline void Threefry2x64::generate(const uint64_t &block)
+    {
+        static constexpr unsigned int rotation[8] = {16, 42, 12, 31, 16, 32, 24, 21};
+        const uint64_t k[3] = {_key[0], _key[1], 0x1BD11BDAA9FC1A22ULL ^ _key[0] ^ _key[1]};
+        uint64_t x0 = block + k[0];
+        uint64_t x1 = _stream + k[1];
+        for (size_t r = 0; r < 20; r++)
+        {
+            x0 += x1;
+            x1 = (x1 << rotation[r % 8]) | (x1 >> (64 - rotation[r % 8]));
+            x1 ^= x0;
+            if (r % 4 == 3)
+            {
+                const size_t s = (r + 1) / 4;
+                x0 += k[s % 3];
+                x1 += k[(s + 1) % 3] + s;
+            }
+        }
+        _output[0] = x0;
+        _output[1] = x1;
+        _block = block;
+        _ready = true;
+    }
+
+    inline void Threefry2x64::seed(const size_t &seed)
+    {
+        _key[0] = seed;
+        _key[1] = 0;
+        _stream = 0;
+        _position = 0;
+        _block = 0;
+        _output[0] = 0;
+        _output[1] = 0;
+        _ready = false;
+    }
+
+    inline const Threefry2x64 Threefry2x64::stream(const uint64_t &id) const
+    {
+        Threefry2x64 engine(*this);
+        engine._stream = id;
+        engine._position = 0;
+        engine._ready = false;
+        return engine;
+    }
+
+    inline void Threefry2x64::skip(const uint64_t &n)
+    {
+        _position += n;
+    }
+
+    inline constexpr Threefry2x64::result_type Threefry2x64::min()
+    {
+        return std::numeric_limits<result_type>::min();
+    }
+
+    inline constexpr Threefry2x64::result_type Threefry2x64::max()
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    inline Threefry2x64::result_type Threefry2x64::operator()()
+    {
+        const uint64_t block = _position >> 1;
+        if (!_ready || block != _block)
+        {
+            generate(block);
+        }
+        return _output[(_position++) & 1];
+    }
+
+    inline Threefry2x64 &Threefry2x64::operator=(const Threefry2x64 &engine)
+    {
+        if (this != &engine)
+        {
+            this->_key[0] = engine._key[0];
+            this->_key[1] = engine._key[1];
+            this->_stream = engine._stream;
+            this->_position = engine._position;
+            this->_block = engine._block;
+            this->_ready = engine._ready;
+            this->_output[0] = engine._output[0];
+            this->_output[1] = engine._output[1];
+        }
+        return (*this);
+    }
+
+    template <typename Engine>
+    inline BasicRandom<Engine>::BasicRandom() : random_engine(_random_engine)
     {
         this->seed((size_t)std::chrono::system_clock::now().time_since_epoch().count());
     }
 
-    inline Random::Random(const size_t &seed) : random_engine(_random_engine)
+    template <typename Engine>
+    inline BasicRandom<Engine>::BasicRandom(const size_t &seed) : random_engine(_random_engine)
     {
         this->seed(seed);
     }
 
-    inline Random::Random(const Random &random) : random_engine(_random_engine), _random_engine(random.random_engine) {}
+    template <typename Engine>
+    inline BasicRandom<Engine>::BasicRandom(const Engine &engine) : _random_engine(engine), random_engine(_random_engine) {}
+
+    template <typename Engine>
+    inline BasicRandom<Engine>::BasicRandom(const BasicRandom &random) : random_engine(_random_engine), _random_engine(random.random_engine) {}
 
-    inline void Random::seed(const size_t &seed)
+    template <typename Engine>
+    inline void BasicRandom<Engine>::seed(const size_t &seed)
     {
         _random_engine.seed((size_t)seed);
     }
 
+    template <typename Engine>
+    template <typename Real>
+    inline void BasicRandom<Engine>::canonical(Real *data, const size_t &n)
+    {
+        static_assert(std::is_floating_point_v<Real>);
+        if constexpr (Engine::min() == 0 && Engine::max() == std::numeric_limits<uint64_t>::max())
+        {
+            constexpr int digits = std::min(std::numeric_limits<Real>::digits, 64);
+            const Real scale = std::ldexp(Real(1.0), -digits);
+            uint64_t buffer[256];
+            for (size_t i = 0; i < n; i += 256)
+            {
+                const size_t m = std::min<size_t>(256, n - i);
+                for (size_t j = 0; j < m; j++)
+                {
+                    buffer[j] = (_random_engine() >> (64 - digits));
+                }
+#pragma omp simd
+                for (size_t j = 0; j < m; j++)
+                {
+                    data[i + j] = Real(buffer[j]) * scale;
+                }
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                data[i] = std::generate_canonical<Real, std::numeric_limits<Real>::digits>(_random_engine);
+            }
+        }
+    }
+
+    template <typename Engine>
     template <typename Type>
-    inline const Type Random::uniform(const Type &min, const Type &max)
+    inline const Type BasicRandom<Engine>::uniform(const Type &min, const Type &max)
     {
         static_assert(std::is_integral_v<Type> || std::is_floating_point_v<Type>);
         if constexpr (std::is_integral_v<Type>)
@@ -38,44 +486,51 @@ namespace mtk
         }
     }
 
+    template <typename Engine>
     template <typename Real>
-    inline const Real Random::normal(const Real &expectation, const Real &variance)
+    inline const Real BasicRandom<Engine>::normal(const Real &expectation, const Real &variance)
     {
         return std::normal_distribution<Real>(expectation, variance)(_random_engine);
     }
 
+    template <typename Engine>
     template <typename Real>
-    inline const bool Random::bernoulli(const Real &p)
+    inline const bool BasicRandom<Engine>::bernoulli(const Real &p)
     {
         return std::bernoulli_distribution((double)p)(_random_engine);
     }
 
+    template <typename Engine>
     template <typename Real>
-    inline const size_t Random::binomial(const size_t &n, const Real &p)
+    inline const size_t BasicRandom<Engine>::binomial(const size_t &n, const Real &p)
     {
         return std::binomial_distribution<size_t>(n, (double)p)(_random_engine);
     }
 
+    template <typename Engine>
     template <typename Real>
-    inline const size_t Random::geometric(const Real &p)
+    inline const size_t BasicRandom<Engine>::geometric(const Real &p)
     {
         return std::geometric_distribution<size_t>((double)p)(_random_engine);
     }
 
+    template <typename Engine>
     template <typename Real>
-    inline const Real Random::exponential(const Real &lambda)
+    inline const Real BasicRandom<Engine>::exponential(const Real &lambda)
     {
         return std::exponential_distribution<Real>(lambda)(_random_engine);
     }
 
+    template <typename Engine>
     template <typename Real>
-    inline const size_t Random::poisson(const Real &lambda)
+    inline const size_t BasicRandom<Engine>::poisson(const Real &lambda)
     {
         return std::poisson_distribution<size_t>((double)lambda)(_random_engine);
     }
 
+    template <typename Engine>
     template <typename OutputType, typename Real>
-    inline const OutputType Random::discreteProbability(const std::vector<std::pair<OutputType, Real>> &p,
+    inline const OutputType BasicRandom<Engine>::discreteProbability(const std::vector<std::pair<OutputType, Real>> &p,
                                                         const size_t &max_loop_num)
     {
         size_t k = 0;
@@ -101,8 +556,9 @@ namespace mtk
         return p.at(res).first;
     }
 
+    template <typename Engine>
     template <typename Real>
-    inline const Real Random::continuousProbability(const Real &min, const Real &max,
+    inline const Real BasicRandom<Engine>::continuousProbability(const Real &min, const Real &max,
                                                     const std::function<const Real(const Real &)> &p,
                                                     const Real &step, const size_t &max_loop_num)
     {
@@ -126,8 +582,9 @@ namespace mtk
         return uniform<Real>(x, x + step);
     }
 
+    template <typename Engine>
     template <typename Real>
-    inline const Real Random::continuousDistribution(const Real &min, const Real &max,
+    inline const Real BasicRandom<Engine>::continuousDistribution(const Real &min, const Real &max,
                                                      const std::function<const Real(const Real &)> &f,
                                                      const Real &epsilon, const Real &delta, const size_t &max_loop_num)
     {
@@ -163,11 +620,1332 @@ namespace mtk
         return m;
     }
 
-    inline Random &Random::operator=(const Random &random)
+    template <typename Engine>
+    template <typename Real>
+    inline void BasicRandom<Engine>::uniform(Real *first, Real *last, const Real &min, const Real &max)
     {
-        if (this != &random)
+        const size_t n = last - first;
+        const Real k = max - min;
+        canonical(first, n);
+#pragma omp simd
+        for (size_t i = 0; i < n; i++)
         {
-            this->_random_engine = random.random_engine;
+            first[i] = min + k * first[i];
+        }
+    }
+
+    template <typename Engine>
+    template <typename Real>
+    inline void BasicRandom<Engine>::uniform(Vector<Real> &v, const Real &min, const Real &max)
+    {
+        uniform(v.data(), v.data() + v.size(), min, max);
+    }
+
+    template <typename Engine>
+    template <typename Real>
+    inline void BasicRandom<Engine>::uniform(Matrix<Real> &m, const Real &min, const Real &max)
+    {
+        uniform(m.data(), m.data() + m.size(), min, max);
+    }
+
+    template <typename Engine>
+    template <typename Real>
+    inline void BasicRandom<Engine>::uniform(Array<Real> &a, const Real &min, const Real &max)
+    {
+        if (a.size() > 0)
+        {
+            uniform(&a[0], &a[0] + a.size(), min, max);
+        }
+    }
+
+    template <typename Engine>
+    template <typename Real>
+    inline void BasicRandom<Engine>::normal(Real *first, Real *last, const Real &expectation, const Real &variance)
+    {
+        const size_t n = last - first;
+        const size_t h = n / 2;
+        const Real pi2 = Real(6.283185307179586476925286766559L);
+        canonical(first, 2 * h);
+#pragma omp simd
+        for (size_t i = 0; i < h; i++)
+        {
+            const Real r = variance * std::sqrt(-2 * std::log(1 - first[i]));
+            const Real theta = pi2 * first[i + h];
+            first[i] = expectation + r * std::cos(theta);
+            first[i + h] = expectation + r * std::sin(theta);
+        }
+        if (n % 2 == 1)
+        {
+            first[n - 1] = normal<Real>(expectation, variance);
+        }
+    }
+
+    template <typename Engine>
+    template <typename Real>
+    inline void BasicRandom<Engine>::normal(Vector<Real> &v, const Real &expectation, const Real &variance)
+    {
+        normal(v.data(), v.data() + v.size(), expectation, variance);
+    }
+
+    template <typename Engine>
+    template <typename Real>
+    inline void BasicRandom<Engine>::normal(Matrix<Real> &m, const Real &expectation, const Real &variance)
+    {
+        normal(m.data(), m.data() + m.size(), expectation, variance);
+    }
+
+    template <typename Engine>
+    template <typename Real>
+    inline void BasicRandom<Engine>::normal(Array<Real> &a, const Real &expectation, const Real &variance)
+    {
+        if (a.size() > 0)
+        {
+            normal(&a[0], &a[0] + a.size(), expectation, variance);
+        }
+    }
+
+    template <typename Engine>
+    template <typename Real>
+    inline void BasicRandom<Engine>::exponential(Real *first, Real *last, const Real &lambda)
+    {
+        const size_t n = last - first;
+        canonical(first, n);
+#pragma omp simd
+        for (size_t i = 0; i < n; i++)
+        {
+            first[i] = -std::log(1 - first[i]) / lambda;
+        }
+    }
+
+    template <typename Engine>
+    template <typename Real>
+    inline void BasicRandom<Engine>::exponential(Vector<Real> &v, const Real &lambda)
+    {
+        exponential(v.data(), v.data() + v.size(), lambda);
+    }
+
+    template <typename Engine>
+    template <typename Real>
+    inline void BasicRandom<Engine>::exponential(Matrix<Real> &m, const Real &lambda)
+    {
+        exponential(m.data(), m.data() + m.size(), lambda);
+    }
+
+    template <typename Engine>
+    template <typename Real>
+    inline void BasicRandom<Engine>::exponential(Array<Real> &a, const Real &lambda)
+    {
+        if (a.size() > 0)
+        {
+            exponential(&a[0], &a[0] + a.size(), lambda);
+        }
+    }
+
+    template <typename Engine>
+    template <typename Iterator, typename Distribution>
+    inline void BasicRandom<Engine>::fill(Iterator first, Iterator last, Distribution &distribution)
+    {
+        for (Iterator it = first; it != last; it++)
+        {
+            *it = distribution(_random_engine);
+        }
+    }
+
+    template <typename Engine>
+    template <typename Real, typename Distribution>
+    inline void BasicRandom<Engine>::fill(Vector<Real> &v, Distribution &distribution)
+    {
+        fill(v.data(), v.data() + v.size(), distribution);
+    }
+
+    template <typename Engine>
+    template <typename Real, typename Distribution>
+    inline void BasicRandom<Engine>::fill(Matrix<Real> &m, Distribution &distribution)
+    {
+        fill(m.data(), m.data() + m.size(), distribution);
+    }
+
+    template <typename Engine>
+    template <typename Real, typename Distribution>
+    inline void BasicRandom<Engine>::fill(Array<Real> &a, Distribution &distribution)
+    {
+        if (a.size() > 0)
+        {
+            fill(&a[0], &a[0] + a.size(), distribution);
+        }
+    }
+
+    template <typename Engine>
+    template <typename Real>
+    inline void BasicRandom<Engine>::fill(Matrix<Real> &m, MultivariateNormal<Real> &distribution)
+    {
+        if (m.rows() != distribution.expectation.size())
+        {
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            exit(0);
+        }
+        m = distribution(_random_engine, m.cols());
+    }
+
+    template <typename Engine>
+    template <typename Distribution>
+    inline const typename Distribution::result_type BasicRandom<Engine>::operator()(Distribution &distribution)
+    {
+        return distribution(_random_engine);
+    }
+
+    template <typename Engine>
+    template <typename Distribution>
+    inline const std::vector<typename Distribution::result_type> BasicRandom<Engine>::operator()(Distribution &distribution,
+                                                                                                const size_t &n)
+    {
+        std::vector<typename Distribution::result_type> res(n);
+        fill(res.begin(), res.end(), distribution);
+        return res;
+    }
+
+    template <typename Engine>
+    template <typename Distribution>
+    inline RandomVariable<Engine, Distribution> BasicRandom<Engine>::variable(const Distribution &distribution)
+    {
+        return RandomVariable<Engine, Distribution>(*this, distribution);
+    }
+
+    template <typename Engine>
+    inline const std::vector<Engine> BasicRandom<Engine>::split(const size_t &n)
+    {
+        std::uniform_int_distribution<uint64_t> bits(0, std::numeric_limits<uint64_t>::max());
+        std::vector<Engine> res;
+        for (size_t i = 0; i < n; i++)
+        {
+            res.push_back(Engine(bits(_random_engine)));
+        }
+        return res;
+    }
+
+    template <typename Engine>
+    template <typename Iterator>
+    inline void BasicRandom<Engine>::merge(Iterator first, Iterator middle, Iterator last, Engine &engine)
+    {
+        std::uniform_int_distribution<uint64_t> bits(0, std::numeric_limits<uint64_t>::max());
+        Iterator i = first;
+        Iterator j = middle;
+        uint64_t coin = 0;
+        size_t count = 0;
+        while (true)
+        {
+            if (count == 0)
+            {
+                coin = bits(engine);
+                count = 64;
+            }
+            const bool flip = coin & 1;
+            coin >>= 1;
+            count--;
+            if (flip)
+            {
+                if (j == last)
+                {
+                    break;
+                }
+                std::iter_swap(i, j);
+                j++;
+            }
+            else if (i == j)
+            {
+                break;
+            }
+            i++;
+        }
+        for (; i != last; i++)
+        {
+            std::iter_swap(i, first + std::uniform_int_distribution<size_t>(0, i - first)(engine));
+        }
+    }
+
+    template <typename Engine>
+    template <typename Iterator>
+    inline void BasicRandom<Engine>::shuffle(Iterator first, Iterator last)
+    {
+        constexpr size_t block = 1 << 16;
+        const size_t n = last - first;
+        size_t part = 1;
+        while (n / part > block && part < 1024)
+        {
+            part <<= 1;
+        }
+        std::vector<Engine> engine = split(part);
+#pragma omp parallel for
+        for (size_t p = 0; p < part; p++)
+        {
+            const Iterator begin = first + n * p / part;
+            const size_t m = n * (p + 1) / part - n * p / part;
+            for (size_t i = m; i > 1; i--)
+            {
+                std::iter_swap(begin + (i - 1), begin + std::uniform_int_distribution<size_t>(0, i - 1)(engine[p]));
+            }
+        }
+        for (size_t width = 1; width < part; width <<= 1)
+        {
+#pragma omp parallel for
+            for (size_t p = 0; p < part; p += 2 * width)
+            {
+                merge(first + n * p / part, first + n * (p + width) / part, first + n * (p + 2 * width) / part, engine[p]);
+            }
+        }
+    }
+
+    template <typename Engine>
+    template <typename Real>
+    inline void BasicRandom<Engine>::shuffle(Vector<Real> &v)
+    {
+        shuffle(v.data(), v.data() + v.size());
+    }
+
+    template <typename Engine>
+    template <typename Type>
+    inline void BasicRandom<Engine>::shuffle(Array<Type> &a)
+    {
+        if (a.size() > 0)
+        {
+            shuffle(&a[0], &a[0] + a.size());
+        }
+    }
+
+    template <typename Engine>
+    inline const std::vector<size_t> BasicRandom<Engine>::permutation(const size_t &n)
+    {
+        std::vector<size_t> res(n);
+#pragma omp parallel for
+        for (size_t i = 0; i < n; i++)
+        {
+            res[i] = i;
+        }
+        shuffle(res.begin(), res.end());
+        return res;
+    }
+
+    template <typename Engine>
+    inline const std::vector<size_t> BasicRandom<Engine>::sample(const size_t &n, const size_t &k)
+    {
+        if (k > n)
+        {
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            exit(0);
+        }
+        std::vector<size_t> res;
+        std::unordered_set<size_t> set;
+        res.reserve(k);
+        set.reserve(k);
+        for (size_t j = n - k; j < n; j++)
+        {
+            const size_t t = std::uniform_int_distribution<size_t>(0, j)(_random_engine);
+            if (set.insert(t).second)
+            {
+                res.push_back(t);
+            }
+            else
+            {
+                set.insert(j);
+                res.push_back(j);
+            }
+        }
+        return res;
+    }
+
+    template <typename Engine>
+    template <typename Iterator>
+    inline const std::vector<typename std::iterator_traits<Iterator>::value_type> BasicRandom<Engine>::reservoir(Iterator first, Iterator last, const size_t &k)
+    {
+        std::vector<typename std::iterator_traits<Iterator>::value_type> res;
+        res.reserve(k);
+        for (; first != last && res.size() < k; first++)
+        {
+            res.push_back(*first);
+        }
+        if (first == last || k == 0)
+        {
+            return res;
+        }
+        const auto u = [&]()
+        { return 1.0 - std::generate_canonical<double, 53>(_random_engine); };
+        double w = std::exp(std::log(u()) / k);
+        while (true)
+        {
+            double skip = std::floor(std::log(u()) / std::log1p(-w));
+            for (; first != last && skip > 0.0; skip--)
+            {
+                first++;
+            }
+            if (first == last)
+            {
+                break;
+            }
+            res[std::uniform_int_distribution<size_t>(0, k - 1)(_random_engine)] = *first;
+            first++;
+            w *= std::exp(std::log(u()) / k);
+        }
+        return res;
+    }
+
+    template <typename Engine>
+    inline const Matrix<size_t> BasicRandom<Engine>::bootstrap(const size_t &n, const size_t &batch)
+    {
+        if (n == 0)
+        {
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            exit(0);
+        }
+        std::vector<Engine> engine = split(batch);
+        Matrix<size_t> res(n, batch);
+#pragma omp parallel for
+        for (size_t b = 0; b < batch; b++)
+        {
+            std::uniform_int_distribution<size_t> index(0, n - 1);
+            for (size_t i = 0; i < n; i++)
+            {
+                res(i, b) = index(engine[b]);
+            }
+        }
+        return res;
+    }
+
+    template <typename Engine>
+    template <typename Real>
+    inline const Matrix<Real> BasicRandom<Engine>::bootstrap(const Vector<Real> &v, const size_t &batch)
+    {
+        const Matrix<size_t> index = bootstrap(v.size(), batch);
+        Matrix<Real> res(v.size(), batch);
+#pragma omp parallel for
+        for (size_t b = 0; b < batch; b++)
+        {
+            for (size_t i = 0; i < size_t(v.size()); i++)
+            {
+                res(i, b) = v(index(i, b));
+            }
+        }
+        return res;
+    }
+
+    template <typename Engine>
+    template <typename Type>
+    inline const Array<Type> BasicRandom<Engine>::bootstrap(const Array<Type> &a, const size_t &batch)
+    {
+        if (a.shape.empty())
+        {
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            exit(0);
+        }
+        const size_t n = a.shape[0];
+        const size_t m = a.size() / n;
+        const Matrix<size_t> index = bootstrap(n, batch);
+        std::vector<size_t> shape = a.shape;
+        shape.insert(shape.begin(), batch);
+        Array<Type> res(shape);
+#pragma omp parallel for
+        for (size_t b = 0; b < batch; b++)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                std::copy(a.data.begin() + index(i, b) * m, a.data.begin() + (index(i, b) + 1) * m, &res[(b * n + i) * m]);
+            }
+        }
+        return res;
+    }
+
+    template <typename Engine>
+    inline BasicRandom<Engine> &BasicRandom<Engine>::operator=(const BasicRandom &random)
+    {
+        if (this != &random)
+        {
+            this->_random_engine = random.random_engine;
+        }
+        return (*this);
+    }
+
+    template <typename Engine, typename Distribution>
+    inline RandomVariable<Engine, Distribution>::RandomVariable(BasicRandom<Engine> &random, const Distribution &distribution)
+        : _random(&random), _distribution(distribution), distribution(_distribution) {}
+
+    template <typename Engine, typename Distribution>
+    inline RandomVariable<Engine, Distribution>::RandomVariable(const RandomVariable &variable)
+        : _random(variable._random), _distribution(variable.distribution), distribution(_distribution) {}
+
+    template <typename Engine, typename Distribution>
+    inline const std::vector<typename RandomVariable<Engine, Distribution>::result_type> RandomVariable<Engine, Distribution>::sample(const size_t &n)
+    {
+        return (*_random)(_distribution, n);
+    }
+
+    template <typename Engine, typename Distribution>
+    inline const typename RandomVariable<Engine, Distribution>::result_type RandomVariable<Engine, Distribution>::operator()()
+    {
+        return (*_random)(_distribution);
+    }
+
+    template <typename Engine, typename Distribution>
+    inline RandomVariable<Engine, Distribution> &RandomVariable<Engine, Distribution>::operator=(const RandomVariable &variable)
+    {
+        if (this != &variable)
+        {
+            this->_random = variable._random;
+            this->_distribution = variable.distribution;
+        }
+        return (*this);
+    }
+
+    template <typename OutputType, typename Real>
+    inline DiscreteProbability<OutputType, Real>::DiscreteProbability(const std::vector<std::pair<OutputType, Real>> &p)
+        : _p(p), _pending(0), _draws(0), p(_p)
+    {
+        build();
+    }
+
+    template <typename OutputType, typename Real>
+    inline DiscreteProbability<OutputType, Real>::DiscreteProbability(const DiscreteProbability &d)
+        : _p(d._p), _prob(d._prob), _alias(d._alias), _tree(d._tree), _pending(d._pending), _draws(d._draws), p(_p) {}
+
+    template <typename OutputType, typename Real>
+    inline void DiscreteProbability<OutputType, Real>::build()
+    {
+        const size_t n = _p.size();
+        Real sum = 0.0;
+        for (size_t i = 0; i < n; i++)
+        {
+            if (_p[i].second < 0)
+            {
+                printf("Error at: file %s line %d.", __FILE__, __LINE__);
+                exit(0);
+            }
+            sum += _p[i].second;
+        }
+        if (n == 0 || sum <= 0)
+        {
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            exit(0);
+        }
+        std::vector<Real> q(n);
+        std::vector<size_t> small, large;
+        for (size_t i = 0; i < n; i++)
+        {
+            q[i] = _p[i].second * n / sum;
+            (q[i] < 1 ? small : large).push_back(i);
+        }
+        _prob.assign(n, Real(1.0));
+        _alias.resize(n);
+        for (size_t i = 0; i < n; i++)
+        {
+            _alias[i] = i;
+        }
+        while (!small.empty() && !large.empty())
+        {
+            const size_t l = small.back();
+            const size_t g = large.back();
+            small.pop_back();
+            large.pop_back();
+            _prob[l] = q[l];
+            _alias[l] = g;
+            q[g] = (q[g] + q[l]) - 1;
+            (q[g] < 1 ? small : large).push_back(g);
+        }
+        _tree.assign(n + 1, Real(0.0));
+        for (size_t i = 1; i <= n; i++)
+        {
+            _tree[i] += _p[i - 1].second;
+            const size_t j = i + (i & (~i + 1));
+            if (j <= n)
+            {
+                _tree[j] += _tree[i];
+            }
+        }
+        _pending = 0;
+        _draws = 0;
+    }
+
+    template <typename OutputType, typename Real>
+    inline const size_t DiscreteProbability<OutputType, Real>::search(Real u) const
+    {
+        const size_t n = _p.size();
+        size_t step = 1;
+        while (2 * step <= n)
+        {
+            step *= 2;
+        }
+        size_t pos = 0;
+        for (; step > 0; step /= 2)
+        {
+            if (pos + step <= n && _tree[pos + step] <= u)
+            {
+                pos += step;
+                u -= _tree[pos];
+            }
+        }
+        return pos;
+    }
+
+    template <typename OutputType, typename Real>
+    inline void DiscreteProbability<OutputType, Real>::setWeight(const size_t &index, const Real &weight)
+    {
+        if (weight < 0)
+        {
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            exit(0);
+        }
+        const size_t n = _p.size();
+        const Real delta = weight - _p.at(index).second;
+        _p[index].second = weight;
+        for (size_t i = index + 1; i <= n; i += (i & (~i + 1)))
+        {
+            _tree[i] += delta;
+        }
+        _pending++;
+        _draws = 0;
+        if (_pending >= n)
+        {
+            build();
+        }
+    }
+
+    template <typename OutputType, typename Real>
+    template <typename Engine>
+    inline const OutputType DiscreteProbability<OutputType, Real>::operator()(Engine &engine)
+    {
+        const size_t n = _p.size();
+        if (_pending != 0 && ++_draws >= n)
+        {
+            build();
+        }
+        if (_pending == 0)
+        {
+            const size_t i = std::uniform_int_distribution<size_t>(0, n - 1)(engine);
+            const Real u = std::generate_canonical<Real, std::numeric_limits<Real>::digits>(engine);
+            return _p[u < _prob[i] ? i : _alias[i]].first;
+        }
+        Real sum = 0.0;
+        for (size_t i = n; i > 0; i -= (i & (~i + 1)))
+        {
+            sum += _tree[i];
+        }
+        if (sum <= 0)
+        {
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            exit(0);
+        }
+        size_t i = n;
+        while (i >= n)
+        {
+            i = search(std::generate_canonical<Real, std::numeric_limits<Real>::digits>(engine) * sum);
+        }
+        return _p[i].first;
+    }
+
+    template <typename OutputType, typename Real>
+    inline DiscreteProbability<OutputType, Real> &DiscreteProbability<OutputType, Real>::operator=(const DiscreteProbability &d)
+    {
+        if (this != &d)
+        {
+            this->_p = d._p;
+            this->_prob = d._prob;
+            this->_alias = d._alias;
+            this->_tree = d._tree;
+            this->_pending = d._pending;
+            this->_draws = d._draws;
+        }
+        return (*this);
+    }
+
+    template <typename Real>
+    inline ContinuousProbability<Real>::ContinuousProbability(const Real &min, const Real &max,
+                                                              const std::function<const Real(const Real &)> &p,
+                                                              const size_t &n)
+        : _min(min), _max(max), min(_min), max(_max)
+    {
+        if (n == 0 || !(min < max))
+        {
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            exit(0);
+        }
+        _step = (max - min) / n;
+        _pdf.resize(n + 1);
+        _cdf.resize(n + 1);
+        for (size_t i = 0; i <= n; i++)
+        {
+            _pdf[i] = p(min + i * _step);
+            if (_pdf[i] < 0)
+            {
+                printf("Error at: file %s line %d.", __FILE__, __LINE__);
+                exit(0);
+            }
+        }
+        _cdf[0] = 0.0;
+        for (size_t i = 0; i < n; i++)
+        {
+            _cdf[i + 1] = _cdf[i] + _step * (_pdf[i] + _pdf[i + 1]) / 2;
+        }
+        if (_cdf[n] <= 0)
+        {
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            exit(0);
+        }
+        _guide.resize(n + 1);
+        for (size_t k = 0, i = 0; k <= n; k++)
+        {
+            while (i < n - 1 && _cdf[i + 1] <= _cdf[n] * k / n)
+            {
+                i++;
+            }
+            _guide[k] = i;
+        }
+    }
+
+    template <typename Real>
+    inline ContinuousProbability<Real>::ContinuousProbability(const ContinuousProbability &d)
+        : _min(d._min), _max(d._max), _step(d._step), _pdf(d._pdf), _cdf(d._cdf), _guide(d._guide), min(_min), max(_max) {}
+
+    template <typename Real>
+    template <typename Engine>
+    inline const Real ContinuousProbability<Real>::operator()(Engine &engine) const
+    {
+        const size_t n = _pdf.size() - 1;
+        const Real u = std::generate_canonical<Real, std::numeric_limits<Real>::digits>(engine);
+        const Real y = u * _cdf[n];
+        size_t i = _guide[std::min<size_t>(size_t(u * n), n)];
+        while (i < n - 1 && _cdf[i + 1] <= y)
+        {
+            i++;
+        }
+        const Real c = y - _cdf[i];
+        const Real f0 = _pdf[i];
+        const Real f1 = _pdf[i + 1];
+        const Real d = std::sqrt(std::max<Real>(f0 * f0 + 2 * (f1 - f0) * c / _step, 0.0));
+        const Real x = (f0 + d > 0) ? (2 * c / (f0 + d)) : Real(0.0);
+        return std::min(_min + i * _step + std::min(x, _step), _max);
+    }
+
+    template <typename Real>
+    inline ContinuousProbability<Real> &ContinuousProbability<Real>::operator=(const ContinuousProbability &d)
+    {
+        if (this != &d)
+        {
+            this->_min = d._min;
+            this->_max = d._max;
+            this->_step = d._step;
+            this->_pdf = d._pdf;
+            this->_cdf = d._cdf;
+            this->_guide = d._guide;
+        }
+        return (*this);
+    }
+
+    template <typename Real>
+    inline ContinuousDistribution<Real>::ContinuousDistribution(const Real &min, const Real &max,
+                                                                const std::function<const Real(const Real &)> &f,
+                                                                const Real &epsilon)
+        : _min(min), _max(max), _epsilon(std::abs(epsilon)), _f(f), min(_min), max(_max)
+    {
+        const Real a = f(min);
+        const Real b = f(max);
+        if (!(min < max) || !(a < b))
+        {
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            exit(0);
+        }
+        _knot.push_back(a);
+        build(a, b, 0);
+    }
+
+    template <typename Real>
+    inline ContinuousDistribution<Real>::ContinuousDistribution(const ContinuousDistribution &d)
+        : _min(d._min), _max(d._max), _epsilon(d._epsilon), _f(d._f), _knot(d._knot), _coefs(d._coefs), min(_min), max(_max) {}
+
+    template <typename Real>
+    inline const Real ContinuousDistribution<Real>::inverse(const Real &y) const
+    {
+        Real l = _min;
+        Real r = _max;
+        const Real delta = std::numeric_limits<Real>::epsilon() * std::max({std::abs(l), std::abs(r), r - l});
+        while (r - l > delta)
+        {
+            const Real m = l + (r - l) / 2;
+            if (m <= l || m >= r)
+            {
+                break;
+            }
+            (_f(m) > y ? r : l) = m;
+        }
+        return l + (r - l) / 2;
+    }
+
+    template <typename Real>
+    inline const Real ContinuousDistribution<Real>::clenshaw(const std::vector<Real> &c, const Real &t) const
+    {
+        Real b1 = 0.0;
+        Real b2 = 0.0;
+        for (size_t j = c.size() - 1; j > 0; j--)
+        {
+            const Real b0 = 2 * t * b1 - b2 + c[j];
+            b2 = b1;
+            b1 = b0;
+        }
+        return t * b1 - b2 + c[0];
+    }
+
+    template <typename Real>
+    inline void ContinuousDistribution<Real>::build(const Real &a, const Real &b, const size_t &depth)
+    {
+        const size_t n = _degree + 1;
+        const Real pi = Real(3.141592653589793238462643383279L);
+        std::vector<Real> g(n);
+        for (size_t k = 0; k < n; k++)
+        {
+            const Real t = std::cos(pi * (k + Real(0.5)) / n);
+            g[k] = inverse(a + (b - a) * (t + 1) / 2);
+        }
+        std::vector<Real> c(n, Real(0.0));
+        for (size_t j = 0; j < n; j++)
+        {
+            for (size_t k = 0; k < n; k++)
+            {
+                c[j] += g[k] * std::cos(pi * j * (k + Real(0.5)) / n);
+            }
+            c[j] *= Real(2.0) / n;
+        }
+        c[0] /= 2;
+        const Real t = Real(0.3183098861837907);
+        const Real error = std::max(std::abs(c[n - 1]) + std::abs(c[n - 2]),
+                                    std::abs(clenshaw(c, t) - inverse(a + (b - a) * (t + 1) / 2)));
+        if (error > _epsilon && depth < _max_depth && (b - a) > 4 * std::numeric_limits<Real>::epsilon())
+        {
+            build(a, a + (b - a) / 2, depth + 1);
+            build(a + (b - a) / 2, b, depth + 1);
+            return;
+        }
+        _knot.push_back(b);
+        _coefs.push_back(c);
+    }
+
+    template <typename Real>
+    inline const Real ContinuousDistribution<Real>::quantile(const Real &y) const
+    {
+        const Real u = std::min(std::max(y, _knot.front()), _knot.back());
+        size_t i = std::upper_bound(_knot.begin() + 1, _knot.end() - 1, u) - _knot.begin() - 1;
+        const Real a = _knot[i];
+        const Real b = _knot[i + 1];
+        const Real x = clenshaw(_coefs[i], (2 * u - a - b) / (b - a));
+        return std::min(std::max(x, _min), _max);
+    }
+
+    template <typename Real>
+    template <typename Engine>
+    inline const Real ContinuousDistribution<Real>::operator()(Engine &engine) const
+    {
+        const Real u = std::generate_canonical<Real, std::numeric_limits<Real>::digits>(engine);
+        return quantile(_knot.front() + u * (_knot.back() - _knot.front()));
+    }
+
+    template <typename Real>
+    inline ContinuousDistribution<Real> &ContinuousDistribution<Real>::operator=(const ContinuousDistribution &d)
+    {
+        if (this != &d)
+        {
+            this->_min = d._min;
+            this->_max = d._max;
+            this->_epsilon = d._epsilon;
+            this->_f = d._f;
+            this->_knot = d._knot;
+            this->_coefs = d._coefs;
+        }
+        return (*this);
+    }
+
+    inline constexpr double Ziggurat::exp(const double &x)
+    {
+        constexpr double ln2 = 0.69314718055994530942;
+        const long k = (long)(x / ln2 + (x < 0 ? -0.5 : 0.5));
+        const double r = x - k * ln2;
+        double term = 1.0;
+        double res = 1.0;
+        for (size_t i = 1; i < 30; i++)
+        {
+            term *= r / i;
+            res += term;
+        }
+        for (long i = 0; i < k; i++)
+        {
+            res *= 2.0;
+        }
+        for (long i = 0; i > k; i--)
+        {
+            res /= 2.0;
+        }
+        return res;
+    }
+
+    inline constexpr double Ziggurat::log(const double &x)
+    {
+        constexpr double ln2 = 0.69314718055994530942;
+        double m = x;
+        long k = 0;
+        while (m >= 2.0)
+        {
+            m /= 2.0;
+            k++;
+        }
+        while (m < 1.0)
+        {
+            m *= 2.0;
+            k--;
+        }
+        const double z = (m - 1.0) / (m + 1.0);
+        double term = z;
+        double res = 0.0;
+        for (size_t i = 1; i < 80; i += 2)
+        {
+            res += term / i;
+            term *= z * z;
+        }
+        return 2.0 * res + k * ln2;
+    }
+
+    inline constexpr double Ziggurat::sqrt(const double &x)
+    {
+        double y = (x > 1.0) ? x : 1.0;
+        for (size_t i = 0; i < 128; i++)
+        {
+            const double z = (y + x / y) / 2.0;
+            if (z == y)
+            {
+                break;
+            }
+            y = z;
+        }
+        return y;
+    }
+
+    inline constexpr std::array<double, Ziggurat::layer + 1> Ziggurat::normal()
+    {
+        constexpr double r = 3.6541528853610088;
+        constexpr double v = 0.00492867323399;
+        std::array<double, layer + 1> x = {};
+        x[0] = v / exp(-r * r / 2.0);
+        x[1] = r;
+        for (size_t i = 1; i < layer - 1; i++)
+        {
+            const double y = v / x[i] + exp(-x[i] * x[i] / 2.0);
+            x[i + 1] = sqrt(-2.0 * log(y < 1.0 ? y : 1.0));
+        }
+        x[layer] = 0.0;
+        return x;
+    }
+
+    inline constexpr std::array<double, Ziggurat::layer + 1> Ziggurat::exponential()
+    {
+        constexpr double r = 7.69711747013104972;
+        constexpr double v = 0.0039496598225815571993;
+        std::array<double, layer + 1> x = {};
+        x[0] = v / exp(-r);
+        x[1] = r;
+        for (size_t i = 1; i < layer - 1; i++)
+        {
+            const double y = v / x[i] + exp(-x[i]);
+            x[i + 1] = -log(y < 1.0 ? y : 1.0);
+        }
+        x[layer] = 0.0;
+        return x;
+    }
+
+    inline constexpr std::array<double, Ziggurat::layer> Ziggurat::ratio(const std::array<double, layer + 1> &x)
+    {
+        std::array<double, layer> res = {};
+        for (size_t i = 0; i < layer; i++)
+        {
+            res[i] = x[i + 1] / x[i];
+        }
+        return res;
+    }
+
+    template <typename Real>
+    inline NormalZiggurat<Real>::NormalZiggurat(const Real &expectation, const Real &variance)
+        : _expectation(expectation), _variance(variance), expectation(_expectation), variance(_variance) {}
+
+    template <typename Real>
+    inline NormalZiggurat<Real>::NormalZiggurat(const NormalZiggurat &d)
+        : _expectation(d.expectation), _variance(d.variance), expectation(_expectation), variance(_variance) {}
+
+    template <typename Real>
+    template <typename Engine>
+    inline const Real NormalZiggurat<Real>::operator()(Engine &engine) const
+    {
+        std::uniform_int_distribution<uint64_t> bits(0, std::numeric_limits<uint64_t>::max());
+        while (true)
+        {
+            const uint64_t b = bits(engine);
+            const size_t i = b & (Ziggurat::layer - 1);
+            const double u = 2.0 * double(b >> 11) * 0x1.0p-53 - 1.0;
+            if (std::abs(u) < _ratio[i])
+            {
+                return _expectation + _variance * Real(u * _x[i]);
+            }
+            if (i == 0)
+            {
+                double a = 0.0;
+                double y = 0.0;
+                do
+                {
+                    a = -std::log(1.0 - std::generate_canonical<double, 53>(engine)) / _x[1];
+                    y = -std::log(1.0 - std::generate_canonical<double, 53>(engine));
+                } while (2.0 * y < a * a);
+                return _expectation + _variance * Real(u < 0 ? -(_x[1] + a) : (_x[1] + a));
+            }
+            const double x = u * _x[i];
+            const double f0 = std::exp(-0.5 * (_x[i] * _x[i] - x * x));
+            const double f1 = std::exp(-0.5 * (_x[i + 1] * _x[i + 1] - x * x));
+            if (f1 + std::generate_canonical<double, 53>(engine) * (f0 - f1) < 1.0)
+            {
+                return _expectation + _variance * Real(x);
+            }
+        }
+    }
+
+    template <typename Real>
+    inline NormalZiggurat<Real> &NormalZiggurat<Real>::operator=(const NormalZiggurat &d)
+    {
+        this->_expectation = d.expectation;
+        this->_variance = d.variance;
+        return (*this);
+    }
+
+    template <typename Real>
+    inline ExponentialZiggurat<Real>::ExponentialZiggurat(const Real &lambda) : _lambda(lambda), lambda(_lambda) {}
+
+    template <typename Real>
+    inline ExponentialZiggurat<Real>::ExponentialZiggurat(const ExponentialZiggurat &d) : _lambda(d.lambda), lambda(_lambda) {}
+
+    template <typename Real>
+    template <typename Engine>
+    inline const Real ExponentialZiggurat<Real>::operator()(Engine &engine) const
+    {
+        std::uniform_int_distribution<uint64_t> bits(0, std::numeric_limits<uint64_t>::max());
+        while (true)
+        {
+            const uint64_t b = bits(engine);
+            const size_t i = b & (Ziggurat::layer - 1);
+            const double u = double(b >> 11) * 0x1.0p-53;
+            if (u < _ratio[i])
+            {
+                return Real(u * _x[i]) / _lambda;
+            }
+            if (i == 0)
+            {
+                return Real(_x[1] - std::log(1.0 - std::generate_canonical<double, 53>(engine))) / _lambda;
+            }
+            const double x = u * _x[i];
+            const double f0 = std::exp(-(_x[i] - x));
+            const double f1 = std::exp(-(_x[i + 1] - x));
+            if (f1 + std::generate_canonical<double, 53>(engine) * (f0 - f1) < 1.0)
+            {
+                return Real(x) / _lambda;
+            }
+        }
+    }
+
+    template <typename Real>
+    inline ExponentialZiggurat<Real> &ExponentialZiggurat<Real>::operator=(const ExponentialZiggurat &d)
+    {
+        this->_lambda = d.lambda;
+        return (*this);
+    }
+
+    template <typename Real>
+    inline MultivariateNormal<Real>::MultivariateNormal(const Vector<Real> &expectation, const Matrix<Real> &covariance)
+        : expectation(_expectation), factor(_factor), diagonal(_diagonal)
+    {
+        if (covariance.rows() != expectation.size() || covariance.cols() != expectation.size())
+        {
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            exit(0);
+        }
+        this->_expectation = expectation;
+        Eigen::LLT<Matrix<Real>> llt(covariance);
+        if (llt.info() == Eigen::Success)
+        {
+            this->_factor = llt.matrixL();
+            return;
+        }
+        Eigen::LDLT<Matrix<Real>> ldlt(covariance);
+        if (ldlt.info() != Eigen::Success || (ldlt.vectorD().array() < -std::numeric_limits<Real>::epsilon() * covariance.diagonal().cwiseAbs().maxCoeff()).any())
+        {
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            exit(0);
+        }
+        this->_factor = ldlt.transpositionsP().transpose() * (Matrix<Real>(ldlt.matrixL()) * ldlt.vectorD().cwiseMax(Real(0.0)).cwiseSqrt().asDiagonal());
+    }
+
+    template <typename Real>
+    inline MultivariateNormal<Real>::MultivariateNormal(const Vector<Real> &expectation, const Matrix<Real> &factor, const Vector<Real> &diagonal)
+        : _expectation(expectation), _factor(factor), expectation(_expectation), factor(_factor), diagonal(_diagonal)
+    {
+        if (factor.rows() != expectation.size() || diagonal.size() != expectation.size() || (diagonal.array() < 0.0).any())
+        {
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            exit(0);
+        }
+        this->_diagonal = diagonal.cwiseSqrt();
+    }
+
+    template <typename Real>
+    inline MultivariateNormal<Real>::MultivariateNormal(const MultivariateNormal &d)
+        : _expectation(d.expectation), _factor(d.factor), _diagonal(d.diagonal), expectation(_expectation), factor(_factor), diagonal(_diagonal) {}
+
+    template <typename Real>
+    inline const Matrix<Real> MultivariateNormal<Real>::covariance() const
+    {
+        Matrix<Real> res = _factor * _factor.transpose();
+        if (_diagonal.size() != 0)
+        {
+            res.diagonal() += _diagonal.cwiseAbs2();
+        }
+        return res;
+    }
+
+    template <typename Real>
+    template <typename Engine>
+    inline const Vector<Real> MultivariateNormal<Real>::operator()(Engine &engine) const
+    {
+        return (*this)(engine, 1).col(0);
+    }
+
+    template <typename Real>
+    template <typename Engine>
+    inline const Matrix<Real> MultivariateNormal<Real>::operator()(Engine &engine, const size_t &n) const
+    {
+        NormalZiggurat<Real> normal;
+        Matrix<Real> z(_factor.cols(), n);
+        for (size_t j = 0; j < n; j++)
+        {
+            for (size_t i = 0; i < size_t(_factor.cols()); i++)
+            {
+                z(i, j) = normal(engine);
+            }
+        }
+        Matrix<Real> res(_expectation.size(), n);
+        res.noalias() = _factor * z;
+        res.colwise() += _expectation;
+        if (_diagonal.size() != 0)
+        {
+            for (size_t j = 0; j < n; j++)
+            {
+                for (size_t i = 0; i < size_t(_diagonal.size()); i++)
+                {
+                    res(i, j) += _diagonal(i) * normal(engine);
+                }
+            }
+        }
+        return res;
+    }
+
+    template <typename Real>
+    inline MultivariateNormal<Real> &MultivariateNormal<Real>::operator=(const MultivariateNormal &d)
+    {
+        if (this != &d)
+        {
+            this->_expectation = d.expectation;
+            this->_factor = d.factor;
+            this->_diagonal = d.diagonal;
+        }
+        return (*this);
+    }
+
+    template <typename Real>
+    inline const Real AdaptiveRejection<Real>::chord(const size_t &i, const Real &x) const
+    {
+        return _h[i] + (_h[i + 1] - _h[i]) / (_x[i + 1] - _x[i]) * (x - _x[i]);
+    }
+
+    template <typename Real>
+    inline void AdaptiveRejection<Real>::segment(const Real &anchor, const Real &end, const size_t &i)
+    {
+        if (anchor == end)
+        {
+            return;
+        }
+        _anchor.push_back(anchor);
+        _end.push_back(end);
+        _value.push_back(chord(i, anchor));
+        _slope.push_back((_h[i + 1] - _h[i]) / (_x[i + 1] - _x[i]));
+    }
+
+    template <typename Real>
+    inline void AdaptiveRejection<Real>::build()
+    {
+        const size_t k = _x.size();
+        _anchor.clear();
+        _end.clear();
+        _value.clear();
+        _slope.clear();
+        segment(_x[0], _min, 0);
+        for (size_t i = 0; i + 1 < k; i++)
+        {
+            if (i == 0)
+            {
+                segment(_x[0], _x[1], 1);
+            }
+            else if (i + 2 == k)
+            {
+                segment(_x[i], _x[i + 1], i - 1);
+            }
+            else
+            {
+                const Real s0 = (_h[i] - _h[i - 1]) / (_x[i] - _x[i - 1]);
+                const Real s1 = (_h[i + 2] - _h[i + 1]) / (_x[i + 2] - _x[i + 1]);
+                Real z = _x[i + 1];
+                if (s0 > s1)
+                {
+                    z = std::clamp((_h[i + 1] - _h[i] + s0 * _x[i] - s1 * _x[i + 1]) / (s0 - s1), _x[i], _x[i + 1]);
+                }
+                segment(_x[i], z, i - 1);
+                segment(z, _x[i + 1], i + 1);
+            }
+        }
+        segment(_x[k - 1], _max, k - 2);
+        Real m = -std::numeric_limits<Real>::infinity();
+        for (size_t j = 0; j < _value.size(); j++)
+        {
+            m = std::max(m, _value[j]);
+            if (std::isfinite(_end[j]))
+            {
+                m = std::max(m, _value[j] + _slope[j] * (_end[j] - _anchor[j]));
+            }
+        }
+        _area.resize(_value.size());
+        for (size_t j = 0; j < _value.size(); j++)
+        {
+            const Real l = _slope[j] * (_end[j] - _anchor[j]);
+            Real a = std::abs(_end[j] - _anchor[j]) * std::exp(_value[j] - m);
+            if (_slope[j] != 0.0)
+            {
+                a = (l > 0.0) ? (std::exp(_value[j] - m + l) - std::exp(_value[j] - m)) / std::abs(_slope[j])
+                              : std::exp(_value[j] - m) * std::abs(std::expm1(l) / _slope[j]);
+            }
+            _area[j] = ((j > 0) ? _area[j - 1] : Real(0.0)) + a;
+        }
+        if (!std::isfinite(_area.back()))
+        {
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            exit(0);
+        }
+    }
+
+    template <typename Real>
+    inline void AdaptiveRejection<Real>::insert(const Real &x, const Real &h)
+    {
+        const size_t i = std::upper_bound(_x.begin(), _x.end(), x) - _x.begin();
+        if (_x.size() >= _max_point || !std::isfinite(h) || (i > 0 && _x[i - 1] == x))
+        {
+            return;
+        }
+        _x.insert(_x.begin() + i, x);
+        _h.insert(_h.begin() + i, h);
+        build();
+    }
+
+    template <typename Real>
+    inline const Real AdaptiveRejection<Real>::squeeze(const Real &x) const
+    {
+        const size_t i = std::upper_bound(_x.begin(), _x.end(), x) - _x.begin();
+        if (i == 0 || i == _x.size())
+        {
+            return -std::numeric_limits<Real>::infinity();
+        }
+        return chord(i - 1, x);
+    }
+
+    template <typename Real>
+    inline AdaptiveRejection<Real>::AdaptiveRejection(const std::function<const Real(const Real &)> &log_density, const std::vector<Real> &point,
+                                                      const Real &min, const Real &max, const size_t &max_point)
+        : _min(min), _max(max), _max_point(max_point), _evaluation(0), _f(log_density), min(_min), max(_max), evaluation(_evaluation), point(_x)
+    {
+        this->_x = point;
+        std::sort(_x.begin(), _x.end());
+        _x.erase(std::unique(_x.begin(), _x.end()), _x.end());
+        if (_x.size() < 3 || _x.front() < _min || _x.back() > _max)
+        {
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            exit(0);
+        }
+        for (size_t i = 0; i < _x.size(); i++)
+        {
+            _h.push_back(_f(_x[i]));
+            _evaluation++;
+            if (!std::isfinite(_h.back()))
+            {
+                printf("Error at: file %s line %d.", __FILE__, __LINE__);
+                exit(0);
+            }
+        }
+        if ((!std::isfinite(_min) && _h[1] <= _h[0]) || (!std::isfinite(_max) && _h[_x.size() - 1] >= _h[_x.size() - 2]))
+        {
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            exit(0);
+        }
+        build();
+    }
+
+    template <typename Real>
+    inline AdaptiveRejection<Real>::AdaptiveRejection(const AdaptiveRejection &d)
+        : min(_min), max(_max), evaluation(_evaluation), point(_x)
+    {
+        (*this) = d;
+    }
+
+    template <typename Real>
+    template <typename Engine>
+    inline const Real AdaptiveRejection<Real>::operator()(Engine &engine)
+    {
+        while (true)
+        {
+            const Real u = std::generate_canonical<Real, std::numeric_limits<Real>::digits>(engine) * _area.back();
+            const size_t j = std::min<size_t>(std::upper_bound(_area.begin(), _area.end(), u) - _area.begin(), _area.size() - 1);
+            const Real v = std::generate_canonical<Real, std::numeric_limits<Real>::digits>(engine);
+            const Real l = _slope[j] * (_end[j] - _anchor[j]);
+            Real x = _anchor[j] + v * (_end[j] - _anchor[j]);
+            if (_slope[j] != 0.0)
+            {
+                x = _anchor[j] + ((l > 0.0) ? (l + std::log(v + (1.0 - v) * std::exp(-l))) : std::log1p(v * std::expm1(l))) / _slope[j];
+            }
+            x = std::clamp(x, std::min(_anchor[j], _end[j]), std::max(_anchor[j], _end[j]));
+            const Real w = std::log(std::generate_canonical<Real, std::numeric_limits<Real>::digits>(engine)) + _value[j] + _slope[j] * (x - _anchor[j]);
+            if (w <= squeeze(x))
+            {
+                return x;
+            }
+            const Real h = _f(x);
+            _evaluation++;
+            insert(x, h);
+            if (w <= h)
+            {
+                return x;
+            }
+        }
+    }
+
+    template <typename Real>
+    inline AdaptiveRejection<Real> &AdaptiveRejection<Real>::operator=(const AdaptiveRejection &d)
+    {
+        if (this != &d)
+        {
+            this->_min = d._min;
+            this->_max = d._max;
+            this->_max_point = d._max_point;
+            this->_evaluation = d._evaluation;
+            this->_f = d._f;
+            this->_x = d._x;
+            this->_h = d._h;
+            this->_anchor = d._anchor;
+            this->_end = d._end;
+            this->_value = d._value;
+            this->_slope = d._slope;
+            this->_area = d._area;
         }
         return (*this);
     }
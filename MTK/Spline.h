@@ -32,6 +32,8 @@ namespace mtk
         Spline(const size_t &degree);
         Spline(const Spline &s);
 
+        const std::vector<Real> derivatives(const Real &x, const size_t &k) const;
+
         const Real operator()(const Real &x) const;
 
         Spline &operator=(const Spline &s);
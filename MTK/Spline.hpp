@@ -1,6 +1,7 @@
 #ifndef MTK_SPLINE_HPP
 #define MTK_SPLINE_HPP
 
+#include <algorithm>
 #include <set>
 
 #include "Spline.h"
@@ -111,15 +112,13 @@ namespace mtk
     inline const size_t Spline::find(const Real &x) const
     {
         const size_t n = poly.size();
-        for (size_t i = 0; i < n; i++)
+        if (n == 0 || x < knot[0] || x > knot[n])
         {
-            if ((knot[i]) <= x && x <= knot[i + 1])
-            {
-                return i;
-            }
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            exit(0);
         }
-        printf("Error at: file %s line %d.", __FILE__, __LINE__);
-        exit(0);
+        const size_t i = std::lower_bound(knot.begin(), knot.begin() + n + 1, x) - knot.begin();
+        return std::min(std::max<size_t>(i, 1), n) - 1;
     }
 
     inline Spline::Spline(const size_t &degree) : degree(_degree), poly(_poly), knot(_knot), _degree(degree) {}
@@ -127,6 +126,11 @@ namespace mtk
     inline Spline::Spline(const Spline &s)
         : degree(_degree), poly(_poly), knot(_knot), _degree(s.degree), _poly(s.poly), _knot(s.knot) {}
 
+    inline const std::vector<Real> Spline::derivatives(const Real &x, const size_t &k) const
+    {
+        return poly[find(x)].derivatives(x, k);
+    }
+
     inline const Real Spline::operator()(const Real &x) const
     {
         const size_t i = find(x);
@@ -56,5 +56,62 @@ int main()
         printf("PASS Time: %6ld(ms). Integrator::NewtonCotesIntegrator.\n", t);
     }
 
+    timer();
+    flag = PASS;
+    const Real mc_exact = std::pow(std::exp(Real(1.0)) - 1.0, 5);
+    const auto mc_f = [](const Vector<Real> &x) -> const Real
+    { return std::exp(x.sum()); };
+    MonteCarloIntegrator<Real> mc(Vector<Real>::Zero(5), Vector<Real>::Ones(5));
+    mc.setTolerance(1e-2);
+    const Real mc_res = mc(mc_f);
+    if (mc.error > 1e-2 || std::abs(mc_res - mc_exact) > 5.0 * mc.error)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    mc.setTolerance(0.0);
+    mc.setMaxSample(1 << 18);
+    mc(mc_f);
+    const Real mc_error = mc.error;
+    MonteCarloIntegrator<Real> mc_antithetic(mc), mc_stratified(mc), mc_quasi(mc), mc_control(mc);
+    mc_antithetic.setAntithetic(true);
+    mc_stratified.setStratified(true);
+    mc_quasi.setQuasi(true);
+    if (std::abs(mc_antithetic(mc_f) - mc_exact) > 5.0 * mc_antithetic.error || mc_antithetic.error > mc_error / 2.0 ||
+        std::abs(mc_stratified(mc_f) - mc_exact) > 5.0 * mc_stratified.error || mc_stratified.error > mc_error / 2.0 ||
+        std::abs(mc_quasi(mc_f) - mc_exact) > 5.0 * mc_quasi.error || mc_quasi.error > mc_error / 10.0)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    const Real mc_control_res = mc_control.control(
+        mc_f, [](const Vector<Real> &x) -> const Real
+        { return 1.0 + x.sum() + x.squaredNorm() / 2.0; },
+        1.0 + 5.0 / 2.0 + 5.0 / 6.0);
+    if (std::abs(mc_control_res - mc_exact) > 5.0 * mc_control.error || mc_control.error > mc_error / 2.0)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    MonteCarloIntegrator<Real> mc_importance(Vector<Real>::Zero(1), Vector<Real>::Zero(1));
+    mc_importance.setTolerance(1e-3);
+    const Real mc_importance_res = mc_importance.importance(
+        [](const Vector<Real> &x) -> const Real
+        { return std::exp(-x(0) * x(0) / 2.0); },
+        [](const Vector<Real> &x) -> const Real
+        { return std::exp(-x(0) * x(0) / 4.5) / std::sqrt(4.5 * M_PI); },
+        [](BasicRandom<Philox4x32> &random) -> const Vector<Real>
+        { return Vector<Real>::Constant(1, random.normal(Real(0.0), Real(1.5))); });
+    if (mc_importance.error > 1e-3 || std::abs(mc_importance_res - std::sqrt(2.0 * M_PI)) > 5.0 * mc_importance.error)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    t = timer();
+    if (flag == PASS)
+    {
+        printf("PASS Time: %6ld(ms). Integrator::MonteCarloIntegrator.\n", t);
+    }
+
     return 0;
-}
\ No newline at end of file
+}
@@ -120,5 +120,59 @@ int main()
     {
         printf("PASS Time: %6ld(ms). Number::Prime.\n", t);
     }
+
+    timer();
+    flag = PASS;
+    Prime q(1000000);
+    PrimeRange range(0, 1000000);
+    if (!std::equal(range.begin(), range.end(), q.num.begin(), q.num.end()))
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    range = PrimeRange(1000000000000, 1000000000000 + 10000);
+    list.clear();
+    for (size_t x = 1000000000001; x <= 1000000000000 + 10000; x += 2)
+    {
+        bool is_prime = true;
+        for (size_t i = 0; i < q.num.size() && q.num[i] * q.num[i] <= x; i++)
+        {
+            if (x % q.num[i] == 0)
+            {
+                is_prime = false;
+                break;
+            }
+        }
+        if (is_prime)
+        {
+            list.push_back(x);
+        }
+    }
+    if (!std::equal(range.begin(), range.end(), list.begin(), list.end()))
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    t = timer();
+    if (flag == PASS)
+    {
+        printf("PASS Time: %6ld(ms). Number::PrimeRange.\n", t);
+    }
+
+    timer();
+    flag = PASS;
+    q.save("Prime.bin");
+    Prime r("Prime.bin");
+    std::remove("Prime.bin");
+    if (r.max != q.max || r.num != q.num)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    t = timer();
+    if (flag == PASS)
+    {
+        printf("PASS Time: %6ld(ms). Number::Prime(file).\n", t);
+    }
     return 0;
 }
\ No newline at end of file
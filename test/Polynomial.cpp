@@ -1,6 +1,8 @@
 #include "Timer.h"
 #include "../MTK/Polynomial.h"
 
+#include <random>
+
 using namespace mtk;
 
 using Real = long double;
@@ -56,5 +58,372 @@ int main()
     {
         printf("PASS Time: %6ld(ms). Polynomial::Polynomial.\n", t);
     }
+
+    timer();
+    flag = PASS;
+    Polynomial<Real> antiderivative = p5.integral(1.0);
+    if (antiderivative.degree != 5 || antiderivative(1.0) != 0.0 || !antiderivative.differential().equal(p5, DELTA * DELTA) ||
+        Polynomial<Real>(std::vector<Real>({2.0})).integral(0.0) != Polynomial<Real>({0.0, 2.0}) || std::abs(integral(p5, Real(0.0))(2.0) - 106.0 / 15.0) > DELTA)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    t = timer();
+    if (flag == PASS)
+    {
+        printf("PASS Time: %6ld(ms). Polynomial::integral.\n", t);
+    }
+
+    timer();
+    flag = PASS;
+    std::mt19937_64 engine(0);
+    std::uniform_real_distribution<Real> coef(-1.0, 1.0);
+    for (const size_t n : {size_t(20), size_t(300), size_t(5000)})
+    {
+        std::vector<Real> a(n + 1), b(n / 2 + 1), c(n + n / 2 + 1, 0.0);
+        for (size_t i = 0; i < a.size(); i++)
+        {
+            a[i] = coef(engine);
+        }
+        for (size_t i = 0; i < b.size(); i++)
+        {
+            b[i] = coef(engine);
+        }
+        for (size_t i = 0; i < a.size(); i++)
+        {
+            for (size_t j = 0; j < b.size(); j++)
+            {
+                c[i + j] += a[i] * b[j];
+            }
+        }
+        Polynomial<Real> product = Polynomial<Real>(a) * Polynomial<Real>(b);
+        if (product.degree != c.size() - 1 || !product.equal(Polynomial<Real>(c), n * DELTA * DELTA))
+        {
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            flag = FAIL;
+        }
+    }
+    t = timer();
+    if (flag == PASS)
+    {
+        printf("PASS Time: %6ld(ms). Polynomial::multiply.\n", t);
+    }
+
+    timer();
+    flag = PASS;
+    if (p2 / Polynomial<Real>({1.0, 1.0}) != Polynomial<Real>({-1.0, 1.0}) || !(p5 % p1).equal(Polynomial<Real>({2.0, 6.0}), DELTA) ||
+        !(p5 / p1).equal(Polynomial<Real>({-3.0, 0.0, 1.0}), DELTA))
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    for (const std::pair<size_t, size_t> &size : {std::make_pair<size_t, size_t>(200, 5), std::make_pair<size_t, size_t>(3000, 1200)})
+    {
+        std::vector<Real> a(size.first + 1), b(size.second + 1);
+        for (size_t i = 0; i < a.size(); i++)
+        {
+            a[i] = coef(engine);
+        }
+        for (size_t i = 0; i < b.size(); i++)
+        {
+            b[i] = coef(engine) / b.size();
+        }
+        b.back() = 1.0;
+        const auto [quotient, remainder] = divmod(Polynomial<Real>(a), Polynomial<Real>(b));
+        if (quotient.degree != size.first - size.second || remainder.degree != size.second - 1 ||
+            !(quotient * Polynomial<Real>(b) + remainder).equal(Polynomial<Real>(a), std::sqrt(DELTA)))
+        {
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            flag = FAIL;
+        }
+    }
+    t = timer();
+    if (flag == PASS)
+    {
+        printf("PASS Time: %6ld(ms). Polynomial::divmod.\n", t);
+    }
+
+    timer();
+    flag = PASS;
+    std::vector<Real> a(51), x(1000003);
+    for (size_t i = 0; i < a.size(); i++)
+    {
+        a[i] = coef(engine) / (i + 1);
+    }
+    for (size_t i = 0; i < x.size(); i++)
+    {
+        x[i] = coef(engine);
+    }
+    Polynomial<Real> poly(a);
+    std::vector<Real> y = poly.evaluate(x);
+    for (size_t i = 0; i < x.size(); i++)
+    {
+        if (std::abs(y[i] - poly(x[i])) > DELTA)
+        {
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            flag = FAIL;
+            break;
+        }
+    }
+    Vector<Real> xv = Vector<Real>::LinSpaced(1000, -2.0, 2.0);
+    Vector<Real> yv = xv.unaryExpr([&poly](const Real &x)
+                                   { return poly(x); });
+    if ((poly.evaluate(xv) - yv).cwiseAbs().maxCoeff() > DELTA * std::pow(2.0, 50))
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    t = timer();
+    if (flag == PASS)
+    {
+        printf("PASS Time: %6ld(ms). Polynomial::evaluate.\n", t);
+    }
+
+    timer();
+    flag = PASS;
+    Polynomial<Real> dpoly = differential(poly), ddpoly = differential(dpoly), dddpoly = differential(ddpoly);
+    for (size_t i = 0; i < 1000; i++)
+    {
+        const std::vector<Real> d = poly.derivatives(x[i], 3);
+        if (std::abs(poly.estrin(x[i]) - poly.horner(x[i])) > DELTA || std::abs(d[0] - poly(x[i])) > DELTA ||
+            std::abs(d[1] - dpoly(x[i])) > DELTA || std::abs(d[2] - ddpoly(x[i])) > DELTA || std::abs(d[3] - dddpoly(x[i])) > DELTA)
+        {
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            flag = FAIL;
+            break;
+        }
+    }
+    Polynomial<Real> wilkinson = Trait<Polynomial<Real>>::identity();
+    for (size_t i = 1; i <= 12; i++)
+    {
+        wilkinson *= Polynomial<Real>({-Real(i) / 7.0, 1.0});
+    }
+    std::vector<Real> wilkinson_root = wilkinson.root(1e-6);
+    for (size_t i = 0; i < wilkinson_root.size(); i++)
+    {
+        if (wilkinson_root.size() != 12 || std::abs(wilkinson(wilkinson_root[i])) > 1e-14 || std::abs(wilkinson_root[i] - Real(i + 1) / 7.0) > 1e-10)
+        {
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            flag = FAIL;
+            break;
+        }
+    }
+    t = timer();
+    if (flag == PASS)
+    {
+        printf("PASS Time: %6ld(ms). Polynomial::derivatives.\n", t);
+    }
+
+    timer();
+    flag = PASS;
+    Polynomial<Real> multiple = Polynomial<Real>({-1.0, 1.0}) * Polynomial<Real>({-1.0, 1.0}) * Polynomial<Real>({-1.0, 1.0}) * Polynomial<Real>({2.0, 1.0});
+    std::vector<Polynomial<Real>::Root> multiple_root = multiple.complexRoot();
+    std::sort(multiple_root.begin(), multiple_root.end(), [](const Polynomial<Real>::Root &a, const Polynomial<Real>::Root &b)
+              { return a.value.real() < b.value.real(); });
+    if (multiple_root.size() != 2 || multiple_root[0].multiplicity != 1 || multiple_root[1].multiplicity != 3 ||
+        std::abs(multiple_root[0].value - std::complex<Real>(-2.0, 0.0)) > multiple_root[0].error ||
+        std::abs(multiple_root[1].value - std::complex<Real>(1.0, 0.0)) > multiple_root[1].error || multiple_root[1].error > std::sqrt(DELTA))
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    Polynomial<Real> unity(2000);
+    unity[0] = -1.0;
+    unity[2000] = 1.0;
+    std::vector<Polynomial<Real>::Root> unity_root = unity.complexRoot();
+    for (size_t i = 0; i < unity_root.size(); i++)
+    {
+        const Real k = std::arg(unity_root[i].value) * 1000.0 / std::numbers::pi_v<Real>;
+        if (unity_root.size() != 2000 || unity_root[i].multiplicity != 1 || std::abs(std::abs(unity_root[i].value) - 1.0) > unity_root[i].error ||
+            std::abs(k - std::round(k)) * std::numbers::pi_v<Real> / 1000.0 > unity_root[i].error)
+        {
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            flag = FAIL;
+            break;
+        }
+    }
+    t = timer();
+    if (flag == PASS)
+    {
+        printf("PASS Time: %6ld(ms). Polynomial::complexRoot.\n", t);
+    }
+
+    timer();
+    flag = PASS;
+    std::vector<Real> interval_root = wilkinson.root(-1.0, 3.0);
+    if (interval_root.size() != 12 || wilkinson.isolate(0.5, 1.2).size() != 5)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    for (size_t i = 0; i < interval_root.size(); i++)
+    {
+        if (std::abs(interval_root[i] - Real(i + 1) / 7.0) > 1e-10)
+        {
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            flag = FAIL;
+            break;
+        }
+    }
+    Polynomial<Real> sparse(400);
+    sparse[0] = -0.5;
+    sparse[1] = 0.1;
+    sparse[400] = 1.0;
+    std::vector<Real> sparse_root = sparse.root(-2.0, 2.0);
+    if (sparse_root.size() != 2 || sparse_root[0] > -0.99 || sparse_root[1] < 0.99 || std::abs(sparse(sparse_root[0])) > DELTA || std::abs(sparse(sparse_root[1])) > DELTA)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    std::vector<Real> endpoint_root = (multiple * Polynomial<Real>({0.0, 1.0})).root(-3.0, 3.0);
+    if (endpoint_root.size() != 5 || std::abs(endpoint_root[0] + 2.0) > DELTA || endpoint_root[1] != 0.0 || std::abs(endpoint_root[2] - 1.0) > std::sqrt(DELTA) ||
+        endpoint_root[2] != endpoint_root[4] || (Polynomial<Real>({0.0, 0.0, 0.0, 1.0}) * Polynomial<Real>({-1.0, 1.0})).root(-1.0, 2.0).size() != 4)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    t = timer();
+    if (flag == PASS)
+    {
+        printf("PASS Time: %6ld(ms). Polynomial::isolate.\n", t);
+    }
+
+    timer();
+    flag = PASS;
+    SparsePolynomial<Real> sparse_1 = Trait<SparsePolynomial<Real>>::basis(1000000) + 1.0;
+    SparsePolynomial<Real> sparse_2 = Trait<SparsePolynomial<Real>>::basis(1000000) - 1.0;
+    SparsePolynomial<Real> sparse_3 = sparse_1 * sparse_2;
+    if (sparse_3.terms.size() != 2 || sparse_3.degree != 2000000 || sparse_3[2000000] != 1.0 || sparse_3[0] != -1.0 || sparse_3[1000000] != 0.0)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    sparse_1[3] = 2.0;
+    sparse_1[3] = 0.0;
+    if (sparse_1.terms.size() != 2 || sparse_1.degree != 1000000 || Polynomial<Real>(sparse_3).degree != 2000000)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    const Real sparse_x = 1.0 - 1e-6;
+    if (std::abs(sparse_3(sparse_x) - (std::pow(sparse_x, 2000000) - 1.0)) > DELTA ||
+        std::abs(sparse_1.differential()(sparse_x) - 1000000 * std::pow(sparse_x, 999999)) > DELTA * 1000000 ||
+        std::abs(sparse_1.integral(0.0)(sparse_x) - std::pow(sparse_x, 1000001) / 1000001 - sparse_x) > DELTA)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    Polynomial<Real> dense_1({1.0, 0.0, -2.0, 0.0, 0.0, 3.0});
+    Polynomial<Real> dense_2({0.0, 4.0, 0.0, 1.0});
+    SparsePolynomial<Real> sparse_4 = SparsePolynomial<Real>(dense_1) * SparsePolynomial<Real>(dense_2) - SparsePolynomial<Real>(dense_2);
+    if (sparse_4.terms.size() != 4 || Polynomial<Real>(sparse_4) != dense_1 * dense_2 - dense_2 || !sparse_4.equal(dense_1 * dense_2 - dense_2) ||
+        std::abs(sparse_4(0.7) - (dense_1 * dense_2 - dense_2)(0.7)) > DELTA)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    t = timer();
+    if (flag == PASS)
+    {
+        printf("PASS Time: %6ld(ms). Polynomial::SparsePolynomial.\n", t);
+    }
+
+    timer();
+    flag = PASS;
+    constexpr StaticPolynomial<Real, 2> static_1({1.0, -2.0, 1.0});
+    constexpr StaticPolynomial<Real, 3> static_2({0.0, 3.0, 0.0, -1.0});
+    constexpr StaticPolynomial<Real, 5> static_3 = static_1 * static_2 - 2.0 * static_1;
+    constexpr Real static_y = static_3(0.5);
+    static_assert(static_3.degree == 5 && static_3.differential().degree == 4 && static_3.integral(0.0).degree == 6);
+    static_assert((static_1 + static_2)[3] == -1.0 && (static_1 - static_2)[1] == -5.0 && static_1.differential()(1.0) == 0.0);
+    const Polynomial<Real> dynamic_3 = Polynomial<Real>(static_1) * Polynomial<Real>(static_2) - 2.0 * Polynomial<Real>(static_1);
+    if (Polynomial<Real>(static_3) != dynamic_3 || StaticPolynomial<Real, 5>(dynamic_3) != static_3 || std::abs(static_y - dynamic_3(0.5)) > DELTA * DELTA ||
+        Polynomial<Real>(static_3.differential()) != dynamic_3.differential() || static_3.integral(1.0).differential() != static_3 || static_3.integral(1.0)(1.0) != 0.0)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    t = timer();
+    if (flag == PASS)
+    {
+        printf("PASS Time: %6ld(ms). Polynomial::StaticPolynomial.\n", t);
+    }
+
+    timer();
+    flag = PASS;
+    const std::function<const Real(const Real &)> runge = [](const Real &x)
+    {
+        return 1.0 / (1.0 + 25.0 * x * x);
+    };
+    BarycentricInterpolator<Real> runge_interpolator = BarycentricInterpolator<Real>::chebyshev(runge, 2001, -1.0, 1.0);
+    std::vector<Real> runge_x(1000);
+    for (size_t i = 0; i < runge_x.size(); i++)
+    {
+        runge_x[i] = -1.0 + 2.0 * (i + 0.5) / runge_x.size();
+    }
+    std::vector<Real> runge_y = runge_interpolator.evaluate(runge_x);
+    for (size_t i = 0; i < runge_x.size(); i++)
+    {
+        if (std::abs(runge_y[i] - runge(runge_x[i])) > 1e-12 || runge_y[i] != runge_interpolator(runge_x[i]))
+        {
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            flag = FAIL;
+            break;
+        }
+    }
+    std::vector<Real> barycentric_x({0.0, 2.0, -1.5, 0.3, 1.1});
+    std::vector<Real> barycentric_y;
+    for (size_t i = 0; i < barycentric_x.size(); i++)
+    {
+        barycentric_y.push_back(p5(barycentric_x[i]));
+    }
+    BarycentricInterpolator<Real> barycentric(std::vector<Real>(barycentric_x.begin(), barycentric_x.begin() + 2), std::vector<Real>(barycentric_y.begin(), barycentric_y.begin() + 2));
+    for (size_t i = 2; i < barycentric_x.size(); i++)
+    {
+        barycentric.add(barycentric_x[i], barycentric_y[i]);
+    }
+    if (std::abs(barycentric(0.7) - p5(0.7)) > DELTA || std::abs(barycentric(-3.0) - p5(-3.0)) > DELTA || barycentric(2.0) != p5(2.0) ||
+        std::abs(barycentric(0.7) - BarycentricInterpolator<Real>(barycentric_x, barycentric_y)(0.7)) > DELTA * DELTA)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    t = timer();
+    if (flag == PASS)
+    {
+        printf("PASS Time: %6ld(ms). Polynomial::BarycentricInterpolator.\n", t);
+    }
+
+    timer();
+    flag = PASS;
+    NewtonInterpolator<Real> stream;
+    for (size_t i = 0; i < 30; i++)
+    {
+        const Real x = std::cos(std::numbers::pi_v<Real> * (i + 0.5) / 30.0);
+        stream.add(x, std::sin(x));
+        if (stream(x) != std::sin(x) || std::abs(stream(0.123) - std::sin(0.123)) > std::max(Real(1e-15), std::pow(Real(0.5), i)))
+        {
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            flag = FAIL;
+            break;
+        }
+    }
+    NewtonInterpolator<Real> window(5);
+    for (size_t i = 0; i < 20; i++)
+    {
+        const Real x = Real(i) * Real(i) / 7.0;
+        window.add(x, p5(x) + ((i < 10) ? std::sin(x) : 0.0));
+    }
+    if (window.node.size() != 5 || window.node.front() != Real(19 * 19) / 7.0 || !window.polynomial().equal(p5, std::sqrt(DELTA)) || std::abs(window(0.7) - p5(0.7)) > DELTA ||
+        !newtonFormula(std::vector<Real>({0.0, 2.0, -1.5, 0.3, 1.1}), std::vector<Real>({p5(0.0), p5(2.0), p5(-1.5), p5(0.3), p5(1.1)})).equal(p5, DELTA))
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    t = timer();
+    if (flag == PASS)
+    {
+        printf("PASS Time: %6ld(ms). Polynomial::NewtonInterpolator.\n", t);
+    }
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,107 @@
+#include "Timer.h"
+#include "../MTK/QuasiRandom.h"
+
+#include <algorithm>
+#include <iostream>
+
+#include <Eigen/Eigen>
+
+using namespace mtk;
+
+using Real = long double;
+
+constexpr bool PASS = true;
+constexpr bool FAIL = !PASS;
+constexpr Real DELTA = std::numeric_limits<float>::epsilon();
+
+int main()
+{
+    size_t t;
+    bool flag = PASS;
+    timer();
+    Sobol sobol2(2);
+    const Real sobol2_point[6][2] = {{0.0, 0.0}, {0.5, 0.5}, {0.75, 0.25}, {0.25, 0.75}, {0.375, 0.375}, {0.875, 0.875}};
+    for (size_t i = 0; i < 6; i++)
+    {
+        Vector<Real> x = sobol2.next<Real>();
+        if (std::abs(x(0) - sobol2_point[i][0]) > DELTA || std::abs(x(1) - sobol2_point[i][1]) > DELTA)
+        {
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            flag = FAIL;
+        }
+    }
+    Sobol sobol(Sobol::max_dimension);
+    Matrix<Real> sobol_point = sobol.next<Real>(4096);
+    for (size_t j = 0; j < Sobol::max_dimension; j++)
+    {
+        std::vector<size_t> digit(4096);
+        for (size_t i = 0; i < 4096; i++)
+        {
+            digit[i] = size_t(sobol_point(j, i) * 4096);
+        }
+        std::sort(digit.begin(), digit.end());
+        for (size_t i = 0; i < 4096; i++)
+        {
+            if (digit[i] != i)
+            {
+                printf("Error at: file %s line %d.", __FILE__, __LINE__);
+                flag = FAIL;
+                break;
+            }
+        }
+    }
+    Sobol sobol_skip(Sobol::max_dimension), sobol_step(Sobol::max_dimension);
+    sobol_skip.skip(1000);
+    for (size_t i = 0; i < 1000; i++)
+    {
+        sobol_step.next<Real>();
+    }
+    if ((sobol_skip.next<Real>() - sobol_step.next<Real>()).norm() > DELTA || (sobol_skip.next<Real>() - sobol_point.col(1001)).norm() > DELTA)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    t = timer();
+    if (flag == PASS)
+    {
+        printf("PASS Time: %6ld(ms). QuasiRandom::Sobol.\n", t);
+    }
+
+    timer();
+    flag = PASS;
+    Halton halton1(1, false);
+    const Real halton1_point[4] = {0.0, 0.5, 0.25, 0.75};
+    for (size_t i = 0; i < 4; i++)
+    {
+        if (std::abs(halton1.next<Real>()(0) - halton1_point[i]) > DELTA)
+        {
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            flag = FAIL;
+        }
+    }
+    Halton halton(1000, true, 1), halton_step(1000, true, 1);
+    Matrix<Real> halton_point = halton.next<Real>(1000);
+    for (size_t i = 0; i < 1000; i++)
+    {
+        if ((halton_step.next<Real>() - halton_point.col(i)).norm() > DELTA)
+        {
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            flag = FAIL;
+        }
+    }
+    for (size_t j = 0; j < 1000; j++)
+    {
+        Real mean = halton_point.row(j).sum() / 1000;
+        if (halton_point.row(j).minCoeff() < 0.0 || halton_point.row(j).maxCoeff() >= 1.0 || std::abs(mean - 0.5) > 0.1)
+        {
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            flag = FAIL;
+        }
+    }
+    t = timer();
+    if (flag == PASS)
+    {
+        printf("PASS Time: %6ld(ms). QuasiRandom::Halton.\n", t);
+    }
+    return 0;
+}
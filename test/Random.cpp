@@ -3,6 +3,8 @@
 
 #include <chrono>
 #include <iostream>
+#include <map>
+#include <numeric>
 
 #include <Eigen/Eigen>
 
@@ -25,5 +27,458 @@ int main()
     {
         printf("PASS Time: %6ld(ms). Random::Random.\n", t);
     }
+
+    timer();
+    flag = PASS;
+    SplitMix64 split1(1), split2(1);
+    for (size_t i = 0; i < 1000; i++)
+    {
+        split1();
+    }
+    split2.advance(1000);
+    if (split1() != split2())
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    Xoshiro256StarStar xoshiro1(1), xoshiro2(1);
+    xoshiro1.jump();
+    xoshiro2.longJump();
+    if (xoshiro1() != 0x332802F81EAAE9D0ULL || xoshiro2() != 0x39F49E454A208207ULL)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    BasicRandom<Xoshiro256StarStar> random_xoshiro(1);
+    Real s1 = 0.0;
+    for (size_t i = 0; i < 1000000; i++)
+    {
+        s1 += random_xoshiro.uniform<Real>(0.0, 1.0);
+    }
+    if (std::abs(s1 / 1000000 - 0.5) > 1e-2)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+#if defined(__SIZEOF_INT128__)
+    PCG64 pcg1(1), pcg2(1);
+    for (size_t i = 0; i < 1000; i++)
+    {
+        pcg1();
+    }
+    pcg2.advance(1000);
+    if (pcg1() != pcg2())
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    pcg1.jump();
+    pcg2.advance(uint64_t(1) << 63);
+    pcg2.advance(uint64_t(1) << 63);
+    if (pcg1() != pcg2())
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    BasicRandom<PCG64> random_pcg(1);
+    Real s2 = 0.0;
+    for (size_t i = 0; i < 1000000; i++)
+    {
+        s2 += random_pcg.uniform<Real>(0.0, 1.0);
+    }
+    if (std::abs(s2 / 1000000 - 0.5) > 1e-2)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+#endif
+    t = timer();
+    if (flag == PASS)
+    {
+        printf("PASS Time: %6ld(ms). Random::Engine.\n", t);
+    }
+
+    timer();
+    flag = PASS;
+    Philox4x32 philox(0);
+    Threefry2x64 threefry(0);
+    if (philox() != 0xE169C58D6627E8D5ULL || philox() != 0x9B00DBD8BC57AC4CULL ||
+        threefry() != 0xC2B6E3A8C2C69865ULL || threefry() != 0x6F81ED42F350084DULL)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    philox = Philox4x32(7).stream(3);
+    Philox4x32 philox_skip = philox;
+    for (size_t i = 0; i < 1001; i++)
+    {
+        philox();
+    }
+    philox_skip.skip(1001);
+    if (philox() != philox_skip())
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    std::vector<Real> serial(256), parallel(256);
+    for (size_t i = 0; i < 256; i++)
+    {
+        BasicRandom<Threefry2x64> random(Threefry2x64(7).stream(i));
+        serial[i] = random.normal<Real>(0.0, 1.0);
+    }
+#pragma omp parallel for
+    for (size_t i = 0; i < 256; i++)
+    {
+        BasicRandom<Threefry2x64> random(Threefry2x64(7).stream(i));
+        parallel[i] = random.normal<Real>(0.0, 1.0);
+    }
+    if (serial != parallel || serial[0] == serial[1])
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    t = timer();
+    if (flag == PASS)
+    {
+        printf("PASS Time: %6ld(ms). Random::CounterEngine.\n", t);
+    }
+
+    timer();
+    flag = PASS;
+    BasicRandom<Xoshiro256StarStar> random_bulk(1);
+    Vector<Real> v(1000001);
+    Matrix<Real> m(1000, 1000);
+    Array<Real> a(1000, 1000);
+    random_bulk.uniform(v, Real(-1.0), Real(3.0));
+    random_bulk.normal(m, Real(2.0), Real(3.0));
+    random_bulk.exponential(a, Real(4.0));
+    Real mean = 0.0;
+    for (size_t i = 0; i < a.size(); i++)
+    {
+        mean += a[i] / a.size();
+    }
+    if (std::abs(v.mean() - 1.0) > 1e-2 || v.minCoeff() < -1.0 || v.maxCoeff() > 3.0 ||
+        std::abs(m.mean() - 2.0) > 1e-2 || std::abs(std::sqrt((m.array() - m.mean()).square().mean()) - 3.0) > 1e-2 ||
+        std::abs(mean - 0.25) > 1e-2)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    std::poisson_distribution<size_t> poisson(3.0);
+    std::vector<size_t> count(100000);
+    random_bulk.fill(count.begin(), count.end(), poisson);
+    if (std::abs(std::accumulate(count.begin(), count.end(), 0.0) / count.size() - 3.0) > 5e-2 || random_bulk(poisson) > 100)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    t = timer();
+    if (flag == PASS)
+    {
+        printf("PASS Time: %6ld(ms). Random::fill.\n", t);
+    }
+
+    timer();
+    flag = PASS;
+    DiscreteProbability<char, Real> discrete({{'a', 0.9}, {'b', 0.09}, {'c', 0.01}});
+    std::vector<char> sample = random_bulk(discrete, 1000000);
+    std::map<char, Real> frequency;
+    for (size_t i = 0; i < sample.size(); i++)
+    {
+        frequency[sample[i]] += 1.0 / sample.size();
+    }
+    if (std::abs(frequency['a'] - 0.9) > 5e-3 || std::abs(frequency['b'] - 0.09) > 5e-3 || std::abs(frequency['c'] - 0.01) > 5e-3)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    discrete.setWeight(0, 0.0);
+    for (size_t i = 0; i < 1000; i++)
+    {
+        if (random_bulk(discrete) == 'a')
+        {
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            flag = FAIL;
+            break;
+        }
+    }
+    std::vector<std::pair<size_t, Real>> uniform(1000);
+    for (size_t i = 0; i < uniform.size(); i++)
+    {
+        uniform[i] = {i, 1.0};
+    }
+    DiscreteProbability<size_t, Real> updated(uniform);
+    for (size_t i = 0; i < uniform.size(); i++)
+    {
+        if (i != 500)
+        {
+            updated.setWeight(i, 0.0);
+        }
+    }
+    for (size_t i = 0; i < 100; i++)
+    {
+        if (random_bulk(updated) != 500)
+        {
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            flag = FAIL;
+            break;
+        }
+    }
+    updated.setWeight(250, 3.0);
+    frequency.clear();
+    for (size_t i = 0; i < 100000; i++)
+    {
+        frequency[random_bulk(updated) == 250 ? 'a' : 'b'] += 1.0 / 100000;
+    }
+    if (std::abs(frequency['a'] - 0.75) > 1e-2)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    t = timer();
+    if (flag == PASS)
+    {
+        printf("PASS Time: %6ld(ms). Random::DiscreteProbability.\n", t);
+    }
+
+    timer();
+    flag = PASS;
+    auto normal = random_bulk.variable(std::normal_distribution<Real>(1.0, 2.0));
+    auto binomial = random_bulk.variable(std::binomial_distribution<size_t>(20, 0.25));
+    std::vector<Real> normal_sample = normal.sample(1000000);
+    std::vector<size_t> binomial_sample = binomial.sample(1000000);
+    if (std::abs(std::accumulate(normal_sample.begin(), normal_sample.end(), Real(0.0)) / normal_sample.size() - 1.0) > 1e-2 ||
+        std::abs(std::accumulate(binomial_sample.begin(), binomial_sample.end(), 0.0) / binomial_sample.size() - 5.0) > 1e-2 ||
+        binomial() > 20)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    t = timer();
+    if (flag == PASS)
+    {
+        printf("PASS Time: %6ld(ms). Random::RandomVariable.\n", t);
+    }
+
+    timer();
+    flag = PASS;
+    ContinuousProbability<Real> triangle(0.0, 2.0, [](const Real &x) -> Real
+                                         { return x < 1.0 ? x : 2.0 - x; });
+    std::vector<Real> triangle_sample = random_bulk(triangle, 1000000);
+    Real below = 0.0;
+    for (size_t i = 0; i < triangle_sample.size(); i++)
+    {
+        below += (triangle_sample[i] < 0.5) ? 1.0 / triangle_sample.size() : 0.0;
+    }
+    if (std::abs(std::accumulate(triangle_sample.begin(), triangle_sample.end(), Real(0.0)) / triangle_sample.size() - 1.0) > 1e-2 ||
+        std::abs(below - 0.125) > 5e-3 ||
+        *std::min_element(triangle_sample.begin(), triangle_sample.end()) < 0.0 ||
+        *std::max_element(triangle_sample.begin(), triangle_sample.end()) > 2.0)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    t = timer();
+    if (flag == PASS)
+    {
+        printf("PASS Time: %6ld(ms). Random::ContinuousProbability.\n", t);
+    }
+
+    timer();
+    flag = PASS;
+    ContinuousDistribution<Real> exponential(0.0, 40.0, [](const Real &x) -> Real
+                                             { return 1.0 - std::exp(-x); });
+    for (Real y = 0.0; y < 0.999; y += 0.001)
+    {
+        if (std::abs(exponential.quantile(y) + std::log(1.0 - y)) > 1e-5)
+        {
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            flag = FAIL;
+            break;
+        }
+    }
+    std::vector<Real> exponential_sample = random_bulk(exponential, 1000000);
+    if (std::abs(std::accumulate(exponential_sample.begin(), exponential_sample.end(), Real(0.0)) / exponential_sample.size() - 1.0) > 1e-2)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    t = timer();
+    if (flag == PASS)
+    {
+        printf("PASS Time: %6ld(ms). Random::ContinuousDistribution.\n", t);
+    }
+
+    timer();
+    flag = PASS;
+    static_assert(Ziggurat::normal()[1] == 3.6541528853610088);
+    static_assert(Ziggurat::normal()[Ziggurat::layer - 1] > 0.0);
+    static_assert(Ziggurat::exponential()[Ziggurat::layer - 1] > 0.0);
+    auto normal_ziggurat = random_bulk.variable(NormalZiggurat<Real>(1.0, 2.0));
+    auto exponential_ziggurat = random_bulk.variable(ExponentialZiggurat<Real>(4.0));
+    std::vector<Real> normal_ziggurat_sample = normal_ziggurat.sample(1000000);
+    std::vector<Real> exponential_ziggurat_sample = exponential_ziggurat.sample(1000000);
+    Real normal_mean = std::accumulate(normal_ziggurat_sample.begin(), normal_ziggurat_sample.end(), Real(0.0)) / 1000000;
+    Real normal_variance = 0.0, normal_tail = 0.0;
+    for (size_t i = 0; i < normal_ziggurat_sample.size(); i++)
+    {
+        normal_variance += std::pow(normal_ziggurat_sample[i] - normal_mean, 2) / 1000000;
+        normal_tail += (normal_ziggurat_sample[i] > 1.0 + 2.0 * 2.0) ? 1.0 / 1000000 : 0.0;
+    }
+    if (std::abs(normal_mean - 1.0) > 1e-2 || std::abs(normal_variance - 4.0) > 5e-2 || std::abs(normal_tail - 0.02275) > 1e-3 ||
+        std::abs(std::accumulate(exponential_ziggurat_sample.begin(), exponential_ziggurat_sample.end(), Real(0.0)) / 1000000 - 0.25) > 1e-2)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    t = timer();
+    if (flag == PASS)
+    {
+        printf("PASS Time: %6ld(ms). Random::Ziggurat.\n", t);
+    }
+
+    timer();
+    flag = PASS;
+    Vector<Real> mvn_expectation(3);
+    mvn_expectation << 1.0, -2.0, 0.5;
+    Matrix<Real> mvn_covariance = Trait<Matrix<Real>>::make({{4.0, 1.2, -0.6}, {1.2, 2.0, 0.3}, {-0.6, 0.3, 1.0}});
+    MultivariateNormal<Real> mvn(mvn_expectation, mvn_covariance);
+    Matrix<Real> mvn_sample(3, 200000);
+    random_bulk.fill(mvn_sample, mvn);
+    if (random_bulk(mvn).size() != 3)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    Vector<Real> mvn_mean = mvn_sample.rowwise().mean();
+    Matrix<Real> mvn_centered = mvn_sample.colwise() - mvn_mean;
+    if ((mvn_mean - mvn_expectation).norm() > 2e-2 || (mvn_centered * mvn_centered.transpose() / 200000 - mvn_covariance).norm() > 5e-2)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    Matrix<Real> mvn_singular = Trait<Matrix<Real>>::make({{1.0, 1.0, 0.0}, {1.0, 1.0, 0.0}, {0.0, 0.0, 2.0}});
+    if ((MultivariateNormal<Real>(mvn_expectation, mvn_singular).covariance() - mvn_singular).norm() > DELTA)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    Matrix<Real> mvn_factor = Matrix<Real>::Random(50, 3);
+    Vector<Real> mvn_diagonal = Vector<Real>::Constant(50, 0.25);
+    MultivariateNormal<Real> mvn_low_rank(Vector<Real>::Zero(50), mvn_factor, mvn_diagonal);
+    Matrix<Real> mvn_low_rank_sample(50, 100000);
+    random_bulk.fill(mvn_low_rank_sample, mvn_low_rank);
+    Matrix<Real> mvn_low_rank_covariance = mvn_factor * mvn_factor.transpose() + Matrix<Real>(mvn_diagonal.asDiagonal());
+    if ((mvn_low_rank.covariance() - mvn_low_rank_covariance).norm() > DELTA ||
+        (mvn_low_rank_sample * mvn_low_rank_sample.transpose() / 100000 - mvn_low_rank_covariance).cwiseAbs().maxCoeff() > 5e-2)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    t = timer();
+    if (flag == PASS)
+    {
+        printf("PASS Time: %6ld(ms). Random::MultivariateNormal.\n", t);
+    }
+
+    timer();
+    flag = PASS;
+    auto ars_normal = random_bulk.variable(AdaptiveRejection<Real>([](const Real &x) -> const Real
+                                                                   { return -(x - 1.0) * (x - 1.0) / 8.0; },
+                                                                   {-1.0, 0.5, 2.0}));
+    std::vector<Real> ars_normal_sample = ars_normal.sample(1000000);
+    Real ars_mean = std::accumulate(ars_normal_sample.begin(), ars_normal_sample.end(), Real(0.0)) / 1000000;
+    Real ars_variance = 0.0;
+    for (size_t i = 0; i < ars_normal_sample.size(); i++)
+    {
+        ars_variance += std::pow(ars_normal_sample[i] - ars_mean, 2) / 1000000;
+    }
+    if (std::abs(ars_mean - 1.0) > 1e-2 || std::abs(ars_variance - 4.0) > 5e-2 || ars_normal.distribution.evaluation > 10000)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    AdaptiveRejection<Real> ars_beta([](const Real &x) -> const Real
+                                     { return std::log(x) + 4.0 * std::log(1.0 - x); },
+                                     {0.1, 0.3, 0.8}, 0.0, 1.0);
+    std::vector<Real> ars_beta_sample = random_bulk(ars_beta, 1000000);
+    if (std::abs(std::accumulate(ars_beta_sample.begin(), ars_beta_sample.end(), Real(0.0)) / 1000000 - 2.0 / 7.0) > 1e-3 ||
+        *std::min_element(ars_beta_sample.begin(), ars_beta_sample.end()) < 0.0 || *std::max_element(ars_beta_sample.begin(), ars_beta_sample.end()) > 1.0)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    t = timer();
+    if (flag == PASS)
+    {
+        printf("PASS Time: %6ld(ms). Random::AdaptiveRejection.\n", t);
+    }
+
+    timer();
+    flag = PASS;
+    const size_t shuffle_size = (1 << 20) + 12345;
+    std::vector<size_t> shuffle_permutation = random_bulk.permutation(shuffle_size);
+    Real shuffle_distance = 0.0;
+    for (size_t i = 0; i < shuffle_size; i++)
+    {
+        shuffle_distance += std::abs(Real(shuffle_permutation[i]) - Real(i)) / shuffle_size;
+    }
+    std::sort(shuffle_permutation.begin(), shuffle_permutation.end());
+    if (std::abs(shuffle_distance / shuffle_size - 1.0 / 3.0) > 1e-2 || shuffle_permutation.front() != 0 ||
+        std::adjacent_find(shuffle_permutation.begin(), shuffle_permutation.end(), [](const size_t &a, const size_t &b)
+                           { return b != a + 1; }) != shuffle_permutation.end())
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    std::vector<Real> floyd_count(10, 0.0), reservoir_count(1000, 0.0);
+    std::vector<size_t> reservoir_data(1000);
+    std::iota(reservoir_data.begin(), reservoir_data.end(), 0);
+    for (size_t i = 0; i < 100000; i++)
+    {
+        std::vector<size_t> floyd = random_bulk.sample(10, 3);
+        std::vector<size_t> reservoir = random_bulk.reservoir(reservoir_data.begin(), reservoir_data.end(), 10);
+        if (floyd[0] == floyd[1] || floyd[0] == floyd[2] || floyd[1] == floyd[2] || reservoir.size() != 10)
+        {
+            printf("Error at: file %s line %d.", __FILE__, __LINE__);
+            flag = FAIL;
+            break;
+        }
+        for (size_t j = 0; j < 3; j++)
+        {
+            floyd_count[floyd[j]] += 1.0 / 100000;
+        }
+        for (size_t j = 0; j < 10; j++)
+        {
+            reservoir_count[reservoir[j]] += 1.0 / 100000;
+        }
+    }
+    if (std::abs(*std::max_element(floyd_count.begin(), floyd_count.end()) - 0.3) > 1e-2 ||
+        std::abs(*std::min_element(floyd_count.begin(), floyd_count.end()) - 0.3) > 1e-2 ||
+        std::abs(*std::max_element(reservoir_count.begin(), reservoir_count.end()) - 0.01) > 2e-3 ||
+        std::abs(*std::min_element(reservoir_count.begin(), reservoir_count.end()) - 0.01) > 2e-3)
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    Vector<Real> bootstrap_data = Vector<Real>::LinSpaced(1000, 0.0, 1.0);
+    Matrix<Real> bootstrap_sample = random_bulk.bootstrap(bootstrap_data, 2000);
+    Array<Real> bootstrap_array(100, 3);
+    for (size_t i = 0; i < bootstrap_array.size(); i++)
+    {
+        bootstrap_array[i] = i / 3;
+    }
+    Array<Real> bootstrap_array_sample = random_bulk.bootstrap(bootstrap_array, 10);
+    if (std::abs(bootstrap_sample.mean() - 0.5) > 1e-2 || bootstrap_sample.minCoeff() < 0.0 || bootstrap_sample.maxCoeff() > 1.0 ||
+        bootstrap_array_sample.shape != std::vector<size_t>({10, 100, 3}) || bootstrap_array_sample({3, 7, 0}) != bootstrap_array_sample({3, 7, 2}))
+    {
+        printf("Error at: file %s line %d.", __FILE__, __LINE__);
+        flag = FAIL;
+    }
+    t = timer();
+    if (flag == PASS)
+    {
+        printf("PASS Time: %6ld(ms). Random::shuffle.\n", t);
+    }
     return 0;
-}
\ No newline at end of file
+}
@@ -29,7 +29,9 @@ int main()
         std::abs(0 - s(-1)) > Trait<float>::epsilon() ||
         std::abs(1 - s(0)) > Trait<float>::epsilon() ||
         std::abs(0 - s(1)) > Trait<float>::epsilon() ||
-        std::abs(-1 - s(2)) > Trait<float>::epsilon())
+        std::abs(-1 - s(2)) > Trait<float>::epsilon() ||
+        std::abs(s.derivatives(0.5, 1)[0] - s(0.5)) > Trait<float>::epsilon() ||
+        std::abs(s.derivatives(0.5, 1)[1] - differential(s.poly[2])(0.5)) > Trait<float>::epsilon())
     {
         printf("Error at: file %s line %d.", __FILE__, __LINE__);
         flag = FAIL;